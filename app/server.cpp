@@ -0,0 +1,117 @@
+#include "dubins/QueryServer.hpp"
+
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace
+{
+volatile std::sig_atomic_t g_stop = 0;
+
+void handle_signal(int)
+{
+    g_stop = 1;
+}
+
+void usage(const char* name)
+{
+    std::cerr << "Usage: " << name << " <socket path> [options]\n"
+              << "  --threads N           worker threads, 0 for one per hardware thread (default 0)\n"
+              << "  --max-batch N         requests that trigger a batch without waiting (default 4096)\n"
+              << "  --max-latency-us N    longest a request waits for its batch to fill (default 200)\n"
+              << "  --max-samples N       largest number of samples in one response (default 1000000)\n"
+              << "  --metrics-interval S  seconds between metrics lines, 0 to disable (default 10)\n";
+}
+
+void print(const dubins::QueryServer::Metrics& metrics)
+{
+    std::cout << "requests " << metrics.requests << " invalid " << metrics.invalid << " batches " << metrics.batches
+              << " connections " << metrics.connections << " mean_batch " << metrics.mean_batch_size
+              << " throughput_per_s " << metrics.throughput << " latency_p50_us " << metrics.latency_p50 * 1e6
+              << " latency_p99_us " << metrics.latency_p99 * 1e6 << " latency_max_us " << metrics.latency_max * 1e6
+              << std::endl;
+}
+
+}    // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    dubins::QueryServer::Options options;
+    options.socket_path = argv[1];
+    double interval     = 10.0;
+
+    for (int i = 2; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+
+        const auto value = std::strtod(argv[++i], nullptr);
+        if (arg == "--threads")
+        {
+            options.threads = static_cast<std::size_t>(value);
+        }
+        else if (arg == "--max-batch")
+        {
+            options.max_batch = static_cast<std::size_t>(value);
+        }
+        else if (arg == "--max-latency-us")
+        {
+            options.max_latency = std::chrono::microseconds(static_cast<std::int64_t>(value));
+        }
+        else if (arg == "--max-samples")
+        {
+            options.max_samples = static_cast<std::size_t>(value);
+        }
+        else if (arg == "--metrics-interval")
+        {
+            interval = value;
+        }
+        else
+        {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto server = dubins::QueryServer::start(options);
+    if (!server)
+    {
+        std::cerr << "Could not listen on " << options.socket_path << "\n";
+        return EXIT_FAILURE;
+    }
+
+    std::signal(SIGINT, handle_signal);
+    std::signal(SIGTERM, handle_signal);
+
+    const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(interval));
+    auto next = std::chrono::steady_clock::now() + period;
+    while (g_stop == 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        const auto now = std::chrono::steady_clock::now();
+        if (interval > 0.0 && now >= next)
+        {
+            print(server->metrics());
+            next = now + period;
+        }
+    }
+
+    server->stop();
+    print(server->metrics());
+    return EXIT_SUCCESS;
+}
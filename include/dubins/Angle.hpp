@@ -5,10 +5,32 @@
 #include <cmath>
 namespace dubins
 {
-// TODO: Make a generic angle class at some point in the future that is not so heavy handed and properly treats edge
-// cases.
+namespace detail
+{
+/// @brief Round to the nearest integer (ties to even) without calling into libm.
+/// @param x argument, |x| < 2^51
+/// @return rounded value, NaN and infinities propagate
+inline double round_nearest(double x) noexcept
+{
+    constexpr double shifter = 6755399441055744.0;    // 1.5 * 2^52
+    return (x + shifter) - shifter;
+}
+
+/// @brief Floor without calling into libm.
+/// @param x argument, |x| < 2^51
+/// @return largest integer not greater than x, NaN and infinities propagate
+inline double floor(double x) noexcept
+{
+    const double r = round_nearest(x);
+    return r - (r > x ? 1.0 : 0.0);
+}
+}    // namespace detail
 
 /// @brief Object representing an angle
+///
+/// Angles are stored wrapped to [0, 2pi). Wrapping uses a branch-free range reduction against a two part 2pi constant
+/// instead of std::fmod. The reduction is exact to within one ulp for |angle| < 4e8, degrades gracefully beyond that
+/// and propagates NaN for non-finite input.
 class Angle
 {
     public:
@@ -34,10 +56,14 @@ class Angle
     /// @brief Get the signed difference c = a-b, right-handed.
     /// @param a minuend
     /// @param b subtrahend
-    /// @return difference
+    /// @return difference in [-pi, pi)
     static double signed_difference(Angle a, Angle b) noexcept
     {
-        return std::fmod(((double)a - (double)b) + 3.0 * M_PI, 2.0 * M_PI) - M_PI;
+        // Both angles are in [0, 2pi) so a single fold in each direction is enough.
+        double diff = (double)a - (double)b;
+        diff += (diff < -M_PI) ? two_pi : 0.0;
+        diff -= (diff >= M_PI) ? two_pi : 0.0;
+        return diff;
     }
 
 
@@ -62,10 +88,24 @@ class Angle
     }
 
     private:
+    static constexpr double two_pi     = 2.0 * M_PI;            ///< 2pi as a double
+    static constexpr double two_pi_hi  = 0x1.921fb5p+2;         ///< 2pi with the low 28 fraction bits cleared
+    static constexpr double two_pi_lo  = two_pi - two_pi_hi;    ///< Remainder of 2pi not in two_pi_hi
+    static constexpr double inv_two_pi = 1.0 / two_pi;          ///< 1/2pi
+
     /// @brief Wrap angle to [0, 2pi)
     /// @param angle argument
     /// @return result
-    static double wrap(double angle) noexcept { return std::fmod(2.0*M_PI + std::fmod(angle, 2.0*M_PI), 2.0*M_PI); }
+    static double wrap(double angle) noexcept
+    {
+        const double k = detail::floor(angle * inv_two_pi);
+        double       r = (angle - k * two_pi_hi) - k * two_pi_lo;
+
+        // Rounding can leave the result a hair outside of [0, 2pi), fold it back in.
+        r += (r < 0.0) ? two_pi : 0.0;
+        r -= (r >= two_pi) ? two_pi : 0.0;
+        return r;
+    }
 
     double m_value{0.0}; ///< Store for angle
 };
@@ -83,4 +123,4 @@ inline double operator+(Angle a, Angle b)
 }    // namespace dubins
 
 
-#endif    // DUBINS_UTILS_HPP
\ No newline at end of file
+#endif    // DUBINS_UTILS_HPP
@@ -0,0 +1,123 @@
+#ifndef DUBINS_ANYTIME_HPP
+#define DUBINS_ANYTIME_HPP
+
+#include "dubins/Dubins.hpp"
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/State.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace dubins
+{
+/// @brief Bits of AnytimeBatch::completed(), one per stage
+namespace completion
+{
+constexpr std::uint8_t bound   = 1;    ///< Lower bound of the length is known
+constexpr std::uint8_t length  = 2;    ///< Shortest path and its exact length are known
+constexpr std::uint8_t samples = 4;    ///< States along the shortest path are known
+}    // namespace completion
+
+/// @brief Cheap lower bound of the shortest path length: the path is at least as long as the distance between the
+/// positions, and it turns through at least the heading change
+/// @param start State of the path start
+/// @param end State at the path end
+/// @param radius Turning radius
+/// @return lower bound
+double length_lower_bound(const State& start, const State& end, double radius) noexcept;
+
+/// @brief Batch of shortest path queries that is worked through in slices under a deadline.
+///
+/// Work is done in three stages: lower bounds of every query first, then exact shortest paths, then states along them.
+/// Each stage handles the queries in order of decreasing priority, a chunk at a time, and checks the deadline and the
+/// cancellation flag between chunks. Whatever is finished is kept, and the next call to run() continues where the last
+/// one stopped, so a batch can be spread over several planning cycles.
+class AnytimeBatch
+{
+    public:
+    using Clock = std::chrono::steady_clock;    ///< Clock of the deadlines
+
+    /// @brief Batch settings
+    struct Options
+    {
+        std::size_t     chunk{64};       ///< Queries per stage between deadline checks
+        bool            sample{true};    ///< Sample the paths after solving them
+        Dubins::Options sampling;        ///< Spacing of the samples, the turning radius is that of the batch
+    };
+
+    /// @brief Create an empty batch
+    AnytimeBatch() = default;
+
+    /// @brief Create a batch, no work is done until run()
+    /// @param starts States of the path starts
+    /// @param ends States at the path ends, as many as starts
+    /// @param radius Turning radius
+    /// @param priorities Priority of each query, higher first, as many as starts. Empty to keep the order of the
+    /// queries.
+    /// @param options batch settings
+    AnytimeBatch(std::vector<State> starts, std::vector<State> ends, double radius,
+                 const std::vector<double>& priorities, const Options& options);
+
+    /// @brief Work on the batch until it is complete, the deadline passes or the flag is set. The chunk in progress
+    /// is finished, so a chunk may overrun the deadline by its own duration.
+    /// @param deadline time to stop at
+    /// @param cancel flag checked between chunks, or null
+    /// @return true if the batch is complete
+    bool run(Clock::time_point deadline = Clock::time_point::max(), const std::atomic<bool>* cancel = nullptr);
+
+    /// @brief Work on the batch for a time budget, see run()
+    /// @param budget time to spend
+    /// @param cancel flag checked between chunks, or null
+    /// @return true if the batch is complete
+    bool run_for(Clock::duration budget, const std::atomic<bool>* cancel = nullptr);
+
+    /// @brief Check if every stage of every query is complete
+    /// @return complete (true), or not
+    bool done() const noexcept;
+
+    /// @brief Get the number of queries
+    /// @return number of queries
+    std::size_t size() const noexcept;
+
+    /// @brief Get the stages completed for each query, see completion
+    /// @return bitmap of completed stages per query
+    const std::vector<std::uint8_t>& completed() const noexcept;
+
+    /// @brief Get the lower bounds of the path lengths, valid where completion::bound is set
+    /// @return lower bounds
+    const std::vector<double>& lower_bounds() const noexcept;
+
+    /// @brief Get the shortest paths, valid where completion::length is set
+    /// @return paths
+    const std::vector<PathDescriptor>& paths() const noexcept;
+
+    /// @brief Get the states along the shortest paths, valid where completion::samples is set
+    /// @return states along each path, start and end included
+    const std::vector<std::vector<State>>& samples() const noexcept;
+
+    /// @brief Get the options the batch was created with
+    /// @return options
+    const Options& options() const noexcept;
+
+    private:
+    void process(std::size_t stage, std::size_t begin, std::size_t end);
+
+    Options                         m_options;
+    double                          m_radius{1.0};
+    std::vector<State>              m_starts;
+    std::vector<State>              m_ends;
+    std::vector<std::uint32_t>      m_order;     ///< Queries by decreasing priority
+    std::array<std::size_t, 3>      m_next{};    ///< Position in m_order of the next query of each stage
+    std::vector<std::uint8_t>       m_completed;
+    std::vector<double>             m_lower_bounds;
+    std::vector<PathDescriptor>     m_paths;
+    std::vector<std::vector<State>> m_samples;
+};
+
+}    // namespace dubins
+
+#endif    // DUBINS_ANYTIME_HPP
@@ -0,0 +1,103 @@
+#ifndef DUBINS_BOUNDS_HPP
+#define DUBINS_BOUNDS_HPP
+
+#include "dubins/Circle.hpp"
+#include "dubins/Line.hpp"
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Primitive.hpp"
+#include "dubins/Vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace dubins
+{
+/// @brief Axis-aligned bounding box. A default constructed box is empty.
+struct BoundingBox
+{
+    Vector2D min{std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity()};    ///< Lower corner
+    Vector2D max{-std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()};  ///< Upper corner
+};
+
+/// @brief Grow a box to contain a point
+/// @param box Box
+/// @param point Point
+inline void expand(BoundingBox& box, const Vector2D& point) noexcept
+{
+    box.min = {std::min(box.min.x, point.x), std::min(box.min.y, point.y)};
+    box.max = {std::max(box.max.x, point.x), std::max(box.max.y, point.y)};
+}
+
+/// @brief Grow a box to contain another box
+/// @param box Box
+/// @param other Box to contain
+inline void expand(BoundingBox& box, const BoundingBox& other) noexcept
+{
+    box.min = {std::min(box.min.x, other.min.x), std::min(box.min.y, other.min.y)};
+    box.max = {std::max(box.max.x, other.max.x), std::max(box.max.y, other.max.y)};
+}
+
+/// @brief Check if two boxes overlap, touching boxes overlap
+/// @param a Box
+/// @param b Box
+/// @return overlap (true), or not
+inline bool overlaps(const BoundingBox& a, const BoundingBox& b) noexcept
+{
+    return a.min.x <= b.max.x && b.min.x <= a.max.x && a.min.y <= b.max.y && b.min.y <= a.max.y;
+}
+
+/// @brief Exact bounding box of a line segment
+/// @param line Line
+/// @return bounding box
+BoundingBox bounds(const Line2D& line) noexcept;
+
+/// @brief Exact bounding box of a circle
+/// @param circle Circle
+/// @return bounding box
+BoundingBox bounds(const Circle& circle) noexcept;
+
+/// @brief Exact bounding box of an arc. Axis extremes of the circle are included when they fall inside the arc.
+/// @param arc Arc
+/// @return bounding box
+BoundingBox bounds(const ArcPrimitive& arc) noexcept;
+
+/// @brief Exact bounding box of a primitive
+/// @param primitive Primitive
+/// @return bounding box
+BoundingBox bounds(const Primitive& primitive) noexcept;
+
+/// @brief Exact bounding box of a path, computed analytically without sampling
+/// @param path path
+/// @return bounding box
+BoundingBox bounds(const PathDescriptor& path) noexcept;
+
+/// @brief Bounding boxes of many paths as a structure of arrays, laid out for vectorized culling
+struct BoundingBoxes
+{
+    std::vector<double> min_x;    ///< Lower x of each box
+    std::vector<double> min_y;    ///< Lower y of each box
+    std::vector<double> max_x;    ///< Upper x of each box
+    std::vector<double> max_y;    ///< Upper y of each box
+
+    /// @brief Number of boxes
+    /// @return number of boxes
+    std::size_t size() const noexcept { return min_x.size(); }
+};
+
+/// @brief Compute the bounding boxes of many paths
+/// @param paths paths
+/// @param out bounding boxes, resized to the number of paths
+/// @param threads worker threads, 0 for one per hardware thread
+void bounds(const std::vector<PathDescriptor>& paths, BoundingBoxes& out, std::size_t threads = 1);
+
+/// @brief Broad-phase culling, find the boxes overlapping a query box
+/// @param boxes Boxes to test
+/// @param query Query box
+/// @param out indices of the overlapping boxes, in increasing order. Cleared first.
+void overlapping(const BoundingBoxes& boxes, const BoundingBox& query, std::vector<std::size_t>& out);
+
+}    // namespace dubins
+
+#endif    // DUBINS_BOUNDS_HPP
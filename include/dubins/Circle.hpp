@@ -4,7 +4,10 @@
 #include "dubins/Line.hpp"
 #include "dubins/Vector.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
+#include <vector>
 
 namespace dubins
 {
@@ -51,6 +54,79 @@ std::optional<CircleCCW> calculate_transfer_circle(const CircleCW& a, const Circ
 std::optional<CircleCW>  calculate_transfer_circle(const CircleCCW& a, const CircleCCW& b, double r) noexcept;
 ///@}
 
+/// @brief Direction of travel around every circle of a batch
+enum class Rotation : std::uint8_t
+{
+    cw,     ///< Clockwise
+    ccw,    ///< Counter-clockwise
+};
+
+/// @brief Circles as a structure of arrays, for the batch kernels
+struct Circles
+{
+    std::vector<double> x;         ///< Center x
+    std::vector<double> y;         ///< Center y
+    std::vector<double> radius;    ///< Radius
+
+    /// @brief Get the number of circles
+    /// @return number of circles
+    std::size_t size() const noexcept { return x.size(); }
+
+    /// @brief Resize every array
+    /// @param n number of circles
+    void resize(std::size_t n)
+    {
+        x.resize(n);
+        y.resize(n);
+        radius.resize(n);
+    }
+};
+
+/// @brief Lines as a structure of arrays, for the batch kernels
+struct Lines
+{
+    std::vector<double> ax;    ///< Start point x
+    std::vector<double> ay;    ///< Start point y
+    std::vector<double> bx;    ///< End point x
+    std::vector<double> by;    ///< End point y
+
+    /// @brief Get the number of lines
+    /// @return number of lines
+    std::size_t size() const noexcept { return ax.size(); }
+
+    /// @brief Resize every array
+    /// @param n number of lines
+    void resize(std::size_t n)
+    {
+        ax.resize(n);
+        ay.resize(n);
+        bx.resize(n);
+        by.resize(n);
+    }
+};
+
+/// @brief Batch form of calculate_transfer_line() for the pairs a[i], b[i]. The loop has no branches, so it vectorizes
+/// and solves one pair per SIMD lane. Entries that are not valid hold unspecified values.
+/// @param a starting circles
+/// @param a_rotation direction of travel around the starting circles
+/// @param b ending circles, as many as a
+/// @param b_rotation direction of travel around the ending circles
+/// @param out tangent lines, resized to the number of pairs
+/// @param valid 1 where the tangent exists, 0 where calculate_transfer_line() would be empty. Resized.
+void calculate_transfer_lines(const Circles& a, Rotation a_rotation, const Circles& b, Rotation b_rotation, Lines& out,
+                              std::vector<std::uint8_t>& valid);
+
+/// @brief Batch form of calculate_transfer_circle() for the pairs a[i], b[i], see calculate_transfer_lines(). The
+/// transfer circles turn opposite to a and b.
+/// @param a starting circles
+/// @param b ending circles, as many as a
+/// @param rotation direction of travel around both a and b
+/// @param r radius of the transfer circles
+/// @param out transfer circles, resized to the number of pairs
+/// @param valid 1 where the transfer circle exists, 0 where calculate_transfer_circle() would be empty. Resized.
+void calculate_transfer_circles(const Circles& a, const Circles& b, Rotation rotation, double r, Circles& out,
+                                std::vector<std::uint8_t>& valid);
+
 /// @brief Check if circle b is inside circle a
 /// @param a outside circle
 /// @param b inside circle
@@ -0,0 +1,89 @@
+#ifndef DUBINS_COST_FIELD_HPP
+#define DUBINS_COST_FIELD_HPP
+
+#include "dubins/State.hpp"
+#include "dubins/Vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace dubins
+{
+/// @brief Precomputed dubins path length from every node of an (x, y, heading) lattice to a fixed goal. Lengths are
+/// quantized to 16 bits and can be saved to a file that is later memory-mapped instead of read. Copies share the data.
+class CostField
+{
+    public:
+    /// @brief Layout of the lattice and solver settings
+    struct Options
+    {
+        Vector2D     origin{0.0, 0.0};       ///< Position of node (0, 0)
+        double       resolution{0.1};        ///< Distance between neighbouring nodes along x and y
+        std::int32_t width{0};               ///< Number of nodes along x
+        std::int32_t height{0};              ///< Number of nodes along y
+        std::int32_t headings{64};           ///< Number of evenly spaced headings per position, starting at 0
+        double       turning_radius{1.0};    ///< Turning radius
+        std::size_t  threads{1};             ///< Worker threads for the precomputation, 0 for one per hardware thread
+    };
+
+    /// @brief Create an empty field
+    CostField() = default;
+
+    /// @brief Compute the field for a goal. Rows of the lattice are computed in parallel.
+    /// @param goal State all paths end at
+    /// @param options Lattice layout and solver settings
+    CostField(const State& goal, const Options& options);
+
+    /// @brief Load a field written by save(). The file is memory-mapped where supported.
+    /// @param filename file to load
+    /// @return field, or empty if the file could not be read or is not a valid field
+    static std::optional<CostField> load(const std::string& filename);
+
+    /// @brief Write the field to a file
+    /// @param filename file to write
+    /// @return true on success
+    bool save(const std::string& filename) const;
+
+    /// @brief Get the path length from a state to the goal, trilinearly interpolated between lattice nodes
+    /// @param state State, the heading may be any angle
+    /// @return interpolated length, or infinity outside the lattice
+    double lookup(const State& state) const noexcept;
+
+    /// @brief Get the stored path length of a single lattice node
+    /// @param x node index along x
+    /// @param y node index along y
+    /// @param heading heading index
+    /// @return dequantized length
+    double at(std::int32_t x, std::int32_t y, std::int32_t heading) const noexcept;
+
+    /// @brief Get the goal state
+    /// @return goal
+    const State& goal() const noexcept;
+
+    /// @brief Get the lattice layout
+    /// @return options the field was computed with
+    const Options& options() const noexcept;
+
+    /// @brief Largest error introduced by quantizing the lengths (interpolation error comes on top)
+    /// @return quantization error bound
+    double quantization_error() const noexcept;
+
+    /// @brief Check if the field holds data
+    /// @return true if the field was computed or loaded
+    bool empty() const noexcept;
+
+    private:
+    std::size_t index(std::int32_t x, std::int32_t y, std::int32_t heading) const noexcept;
+
+    State                                m_goal{{0.0, 0.0}, 0.0};
+    Options                              m_options;
+    double                               m_scale{0.0};    ///< Length of one quantization step
+    std::shared_ptr<const std::uint16_t> m_data;          ///< Quantized lengths, heading fastest then x then y
+};
+
+}    // namespace dubins
+
+#endif    // DUBINS_COST_FIELD_HPP
@@ -0,0 +1,112 @@
+#ifndef DUBINS_DISTANCE_MATRIX_HPP
+#define DUBINS_DISTANCE_MATRIX_HPP
+
+#include "dubins/State.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace dubins
+{
+/// @brief Dubins path lengths between every ordered pair of a set of states, stored out of core in a memory-mapped
+/// file. The matrix is split into square tiles that are computed in parallel while a writer thread flushes finished
+/// tiles to the file, so computation overlaps with I/O. Every tile has a completion flag that is only set once its
+/// data has reached the file, and a run on the same states resumes from the tiles that are not yet flagged.
+///
+/// File layout: a 128 byte header, one completion byte per tile, then the tiles in row-major order starting at a 4096
+/// byte aligned offset. Each tile holds tile * tile entries in row-major order, padded at the matrix edges.
+class DistanceMatrix
+{
+    public:
+    /// @brief Storage type of the lengths
+    enum class Precision : std::uint8_t
+    {
+        float16,    ///< IEEE half precision, about 3 significant digits, lengths above 65504 are stored as infinity
+        float32     ///< IEEE single precision
+    };
+
+    /// @brief Tiling and solver settings
+    struct Options
+    {
+        std::uint32_t tile{256};                       ///< Number of rows and columns in a tile
+        Precision     precision{Precision::float32};    ///< Storage type of the lengths
+        std::size_t   threads{1};    ///< Worker threads computing tiles, 0 for one per hardware thread
+    };
+
+    /// @brief Create an empty matrix
+    DistanceMatrix() = default;
+
+    /// @brief Compute the matrix into a file. If the file holds a matrix of the same states, radius and options, only
+    /// its unfinished tiles are computed.
+    /// @param states States, entry (i, j) is the length of the shortest path from states[i] to states[j]
+    /// @param radius Turning radius
+    /// @param filename file to write
+    /// @param options tiling and solver settings
+    /// @return matrix backed by the file, or empty if the file could not be written
+    static std::optional<DistanceMatrix> compute(const std::vector<State>& states, double radius,
+                                                 const std::string& filename, const Options& options);
+
+    /// @brief Load a matrix written by compute(). The file is memory-mapped where supported.
+    /// @param filename file to load
+    /// @return matrix, or empty if the file is not a valid matrix or has unfinished tiles
+    static std::optional<DistanceMatrix> load(const std::string& filename);
+
+    /// @brief Get a path length
+    /// @param from index of the start state
+    /// @param to index of the end state
+    /// @return length of the shortest path
+    double at(std::size_t from, std::size_t to) const noexcept;
+
+    /// @brief Get the number of states
+    /// @return number of rows and columns
+    std::size_t size() const noexcept;
+
+    /// @brief Get the turning radius the matrix was computed with
+    /// @return turning radius
+    double radius() const noexcept;
+
+    /// @brief Get the options the matrix was computed with
+    /// @return options
+    const Options& options() const noexcept;
+
+    /// @brief Check if the matrix is empty
+    /// @return true if the matrix was not computed or loaded
+    bool empty() const noexcept;
+
+    private:
+    std::shared_ptr<const std::uint8_t> m_data;    ///< First tile
+    std::size_t                         m_size{0};
+    std::size_t                         m_tiles{0};    ///< Number of tiles along a row
+    double                              m_radius{1.0};
+    Options                             m_options;
+};
+
+/// @brief The k shortest paths leaving every state, stored row-major as size() rows of k entries sorted by length
+struct NearestNeighbours
+{
+    std::size_t                k{0};      ///< Number of entries per row
+    std::vector<std::uint32_t> index;     ///< Index of the end state
+    std::vector<double>        length;    ///< Length of the path
+
+    /// @brief Get the number of rows
+    /// @return number of states
+    std::size_t size() const noexcept { return k == 0 ? 0 : index.size() / k; }
+};
+
+/// @brief Find the k shortest paths from every state to the other states without materializing the full matrix. Rows
+/// are solved against blocks of columns with one_to_many() while a bounded heap per row keeps the k best.
+/// @param states States
+/// @param radius Turning radius
+/// @param k number of neighbours per state, clamped to the number of other states
+/// @param threads worker threads, 0 for one per hardware thread
+/// @return neighbours of every state
+NearestNeighbours nearest_neighbours(const std::vector<State>& states, double radius, std::size_t k,
+                                     std::size_t threads = 1);
+
+}    // namespace dubins
+
+#endif    // DUBINS_DISTANCE_MATRIX_HPP
@@ -1,21 +1,18 @@
 #ifndef DUBINS_DUBINS_HPP
 #define DUBINS_DUBINS_HPP
 
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Primitive.hpp"
+#include "dubins/State.hpp"
 #include "dubins/Vector.hpp"
 
 #include <cstdint>
 #include <memory>
+#include <memory_resource>
 #include <vector>
 
 namespace dubins
 {
-/// @brief Object representing state on path
-struct State
-{
-    Vector2D position;    ///< Position
-    double   heading;     ///< Heading
-};
-
 /// @brief Object for calculating the dubins shortest path
 class Dubins
 {
@@ -36,6 +33,14 @@ class Dubins
     /// @return Object representing a dubins shortest path
     Dubins(const State& start, const State& end, const Options& options) noexcept;
 
+    /// @brief Create shortest path between start and end state, allocating internal storage from a memory resource
+    /// @param start State of the path start
+    /// @param end State at the path end
+    /// @param options Options for generating path
+    /// @param resource Memory resource for internal storage, must outlive the object
+    /// @return Object representing a dubins shortest path
+    Dubins(const State& start, const State& end, const Options& options, std::pmr::memory_resource* resource);
+
     /// @brief Destructor
     ~Dubins();
 
@@ -47,38 +52,129 @@ class Dubins
     /// @param options Options for generating path
     std::vector<State> segmented_path(const Options& options) noexcept;
 
+    /// @brief Get the path seperated into segments, allocated from a memory resource
+    /// @param options Options for generating path
+    /// @param resource Memory resource for the returned states
+    std::pmr::vector<State> segmented_path(const Options& options, std::pmr::memory_resource* resource);
+
+    /// @brief Get the fewest states along the path that keep the polyline through them within a maximum distance of
+    /// the path. Lines are reduced to their end points while arcs get a density driven by their curvature.
+    /// @param max_chord_error maximum distance between the polyline and the path, empty result unless positive
+    std::vector<State> adaptive_path(double max_chord_error) const noexcept;
+
+    /// @brief Get the fewest states within a maximum chord error of the path, allocated from a memory resource
+    /// @param max_chord_error maximum distance between the polyline and the path, empty result unless positive
+    /// @param resource Memory resource for the returned states
+    std::pmr::vector<State> adaptive_path(double max_chord_error, std::pmr::memory_resource* resource) const;
+
+    /// @brief Get the path as analytic arcs and lines
+    /// @return primitives of the shortest path, in order of travel
+    Primitives primitives() const noexcept;
+
+    /// @brief Get a compact, copyable description of the path
+    /// @return descriptor of the shortest path
+    PathDescriptor descriptor() const noexcept;
+
 
     /// @brief Get the rsr generated path
     /// @param options Options for generating path
     std::vector<State> segmented_rsr(const Options& options) noexcept;
 
+    /// @brief Get the rsr generated path, allocated from a memory resource
+    /// @param options Options for generating path
+    /// @param resource Memory resource for the returned states
+    std::pmr::vector<State> segmented_rsr(const Options& options, std::pmr::memory_resource* resource);
+
     /// @brief Get the lsl generated path
     /// @param options Options for generating path
     std::vector<State> segmented_lsl(const Options& options) noexcept;
 
+    /// @brief Get the lsl generated path, allocated from a memory resource
+    /// @param options Options for generating path
+    /// @param resource Memory resource for the returned states
+    std::pmr::vector<State> segmented_lsl(const Options& options, std::pmr::memory_resource* resource);
+
     /// @brief Get the rsl generated path
     /// @param options Options for generating path
     std::vector<State> segmented_rsl(const Options& options) noexcept;
 
+    /// @brief Get the rsl generated path, allocated from a memory resource
+    /// @param options Options for generating path
+    /// @param resource Memory resource for the returned states
+    std::pmr::vector<State> segmented_rsl(const Options& options, std::pmr::memory_resource* resource);
+
     /// @brief Get the lsr generated path
     /// @param options Options for generating path
     std::vector<State> segmented_lsr(const Options& options) noexcept;
 
+    /// @brief Get the lsr generated path, allocated from a memory resource
+    /// @param options Options for generating path
+    /// @param resource Memory resource for the returned states
+    std::pmr::vector<State> segmented_lsr(const Options& options, std::pmr::memory_resource* resource);
+
     /// @brief Get the lrl generated path
     /// @param options Options for generating path
     std::vector<State> segmented_lrl(const Options& options) noexcept;
 
+    /// @brief Get the lrl generated path, allocated from a memory resource
+    /// @param options Options for generating path
+    /// @param resource Memory resource for the returned states
+    std::pmr::vector<State> segmented_lrl(const Options& options, std::pmr::memory_resource* resource);
+
     /// @brief Get the rlr generated path
     /// @param options Options for generating path
     std::vector<State> segmented_rlr(const Options& options) noexcept;
 
+    /// @brief Get the rlr generated path, allocated from a memory resource
+    /// @param options Options for generating path
+    /// @param resource Memory resource for the returned states
+    std::pmr::vector<State> segmented_rlr(const Options& options, std::pmr::memory_resource* resource);
+
     private:
     /// @brief Internal implementation of dubins path class
     class Path;
 
-    std::unique_ptr<Path> pimpl;    ///< Pointer to interal path data
+    /// @brief Destroys the path and returns its storage to the resource it was allocated from
+    struct PathDeleter
+    {
+        std::pmr::memory_resource* resource{nullptr};    ///< Resource the path was allocated from
+
+        void operator()(Path* path) const noexcept;
+    };
+
+    std::unique_ptr<Path, PathDeleter> pimpl;    ///< Pointer to interal path data
 };
 
+/// @brief Get a path descriptor seperated into evenly spaced segments. The path is split into
+/// max(min_number_of_segments, ceil(length / max_segment_length)) segments, the end state is included.
+/// @param path path
+/// @param options Options for generating path, the turning radius is taken from the descriptor
+/// @return states along the path
+std::vector<State> segmented_path(const PathDescriptor& path, const Dubins::Options& options);
+
+/// @brief Get a path descriptor seperated into evenly spaced segments, allocated from a memory resource
+/// @param path path
+/// @param options Options for generating path, the turning radius is taken from the descriptor
+/// @param resource Memory resource for the returned states
+/// @return states along the path
+std::pmr::vector<State> segmented_path(const PathDescriptor& path, const Dubins::Options& options,
+                                       std::pmr::memory_resource* resource);
+
+/// @brief Get the fewest states along a path descriptor that keep the polyline through them within a maximum distance
+/// of the path. The start and end states are included.
+/// @param path path
+/// @param max_chord_error maximum distance between the polyline and the path
+/// @return states along the path, empty unless max_chord_error is positive
+std::vector<State> adaptive_path(const PathDescriptor& path, double max_chord_error);
+
+/// @brief Get the fewest states within a maximum chord error of a path descriptor, allocated from a memory resource
+/// @param path path
+/// @param max_chord_error maximum distance between the polyline and the path
+/// @param resource Memory resource for the returned states
+/// @return states along the path, empty unless max_chord_error is positive
+std::pmr::vector<State> adaptive_path(const PathDescriptor& path, double max_chord_error,
+                                      std::pmr::memory_resource* resource);
+
 }    // namespace dubins
 
 
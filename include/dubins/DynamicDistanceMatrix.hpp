@@ -0,0 +1,95 @@
+#ifndef DUBINS_DYNAMIC_DISTANCE_MATRIX_HPP
+#define DUBINS_DYNAMIC_DISTANCE_MATRIX_HPP
+
+#include "dubins/State.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace dubins
+{
+/// @brief Dubins path lengths between every ordered pair of a changing set of states. States are held in slots with
+/// stable ids: inserting, removing or moving a state only recomputes its own row and column, and removed slots are
+/// reused by later inserts until compact() reclaims them.
+class DynamicDistanceMatrix
+{
+    public:
+    /// @brief Id of a slot
+    using Id = std::uint32_t;
+
+    /// @brief Id that refers to no slot
+    static constexpr Id invalid_id = std::numeric_limits<Id>::max();
+
+    /// @brief Create an empty matrix
+    /// @param radius Turning radius
+    /// @param threads worker threads for recomputing rows and columns, 0 for one per hardware thread
+    explicit DynamicDistanceMatrix(double radius = 1.0, std::size_t threads = 1);
+
+    /// @brief Add a state, reusing a removed slot if there is one
+    /// @param state State
+    /// @return id of the state
+    Id insert(const State& state);
+
+    /// @brief Remove a state. Its slot keeps its storage until it is reused or compacted.
+    /// @param id id of the state
+    void erase(Id id);
+
+    /// @brief Move a state
+    /// @param id id of the state
+    /// @param state new state
+    void update(Id id, const State& state);
+
+    /// @brief Move the states into the lowest slots and release the storage of removed slots
+    /// @return new id of every old id, invalid_id for removed slots
+    std::vector<Id> compact();
+
+    /// @brief Get a path length
+    /// @param from id of the start state
+    /// @param to id of the end state
+    /// @return length of the shortest path
+    double at(Id from, Id to) const noexcept;
+
+    /// @brief Get a state
+    /// @param id id of the state
+    /// @return state
+    const State& state(Id id) const noexcept;
+
+    /// @brief Check if a slot holds a state
+    /// @param id id of the slot
+    /// @return true if the state exists
+    bool contains(Id id) const noexcept;
+
+    /// @brief Get the ids of all states
+    /// @return ids in increasing order
+    std::vector<Id> ids() const;
+
+    /// @brief Get the number of states
+    /// @return number of states
+    std::size_t size() const noexcept;
+
+    /// @brief Get the number of slots, including removed ones
+    /// @return number of slots
+    std::size_t slots() const noexcept;
+
+    /// @brief Get the turning radius
+    /// @return turning radius
+    double radius() const noexcept;
+
+    private:
+    void reserve(std::size_t capacity);
+    void recompute(Id id);
+
+    double              m_radius;
+    std::size_t         m_threads;
+    std::size_t         m_capacity{0};    ///< Row stride of m_lengths
+    std::vector<State>  m_states;         ///< State of every slot, removed slots keep their last state
+    std::vector<bool>   m_alive;
+    std::vector<Id>     m_free;           ///< Removed slots, reused last in first out
+    std::vector<double> m_lengths;        ///< Row-major m_capacity x m_capacity lengths
+};
+
+}    // namespace dubins
+
+#endif    // DUBINS_DYNAMIC_DISTANCE_MATRIX_HPP
@@ -0,0 +1,40 @@
+#ifndef DUBINS_FREE_HEADING_HPP
+#define DUBINS_FREE_HEADING_HPP
+
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/State.hpp"
+#include "dubins/Vector.hpp"
+
+namespace dubins
+{
+/// @brief Shortest path to a point together with the heading it arrives with
+struct FreeHeadingPath
+{
+    PathDescriptor path;            ///< Shortest path
+    double         heading{0.0};    ///< Heading at the goal, in [-pi, pi)
+};
+
+/// @brief Solve for the shortest path from a state to a point with any terminal heading. The optimum is a turn
+/// followed by a straight line (LS, RS) or by a second turn (LR, RL), all of which are solved analytically. The path
+/// is returned as the word with the same leading segments and a zero length final segment (LSL, RSR, LRL or RLR).
+/// @param start State of the path start
+/// @param goal Point at the path end
+/// @param radius Turning radius
+/// @return shortest path and its terminal heading
+FreeHeadingPath shortest_path_to_point(const State& start, const Vector2D& goal, double radius) noexcept;
+
+/// @brief Solve for the shortest path from a state to a point with a terminal heading in an interval. The optimum is
+/// either a free heading candidate arriving inside the interval, or the shortest path to one of its boundaries.
+/// @param start State of the path start
+/// @param goal Point at the path end
+/// @param heading_min Start of the heading interval
+/// @param heading_max End of the heading interval, counter-clockwise from heading_min. An interval of 2pi or more, such
+/// as [-pi, pi], allows any heading.
+/// @param radius Turning radius
+/// @return shortest path and its terminal heading
+FreeHeadingPath shortest_path_to_interval(const State& start, const Vector2D& goal, double heading_min,
+                                         double heading_max, double radius) noexcept;
+
+}    // namespace dubins
+
+#endif    // DUBINS_FREE_HEADING_HPP
@@ -0,0 +1,89 @@
+#ifndef DUBINS_GRADIENT_HPP
+#define DUBINS_GRADIENT_HPP
+
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/State.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace dubins
+{
+/// @brief Derivatives with respect to the start x, y and heading, the end x, y and heading and the turning radius, in
+/// that order
+using Gradient = std::array<double, 7>;
+
+/// @brief Index of each parameter in a Gradient
+namespace gradient_index
+{
+constexpr std::size_t start_x       = 0;    ///< Start x
+constexpr std::size_t start_y       = 1;    ///< Start y
+constexpr std::size_t start_heading = 2;    ///< Start heading
+constexpr std::size_t end_x         = 3;    ///< End x
+constexpr std::size_t end_y         = 4;    ///< End y
+constexpr std::size_t end_heading   = 5;    ///< End heading
+constexpr std::size_t radius        = 6;    ///< Turning radius
+}    // namespace gradient_index
+
+/// @brief A path and the derivatives of its segment lengths with respect to its end points and turning radius
+struct PathGradient
+{
+    PathDescriptor          path;                  ///< Path the derivatives belong to
+    std::array<Gradient, 3> segments{};            ///< Derivative of each segment length
+    Gradient                length{};              ///< Derivative of the path length
+    bool                    near_switch{false};    ///< Close to a point where the derivative is discontinuous
+};
+
+/// @brief A state along a path and its derivatives
+struct PoseGradient
+{
+    State    state{{0.0, 0.0}, 0.0};    ///< State, heading in [-pi, pi)
+    Gradient x{};                       ///< Derivative of x
+    Gradient y{};                       ///< Derivative of y
+    Gradient heading{};                 ///< Derivative of the heading
+};
+
+/// @brief Get the closed form derivatives of a path of a fixed word, the word is kept as the end points move.
+///
+/// The derivative is discontinuous where a segment wraps between zero and a full turn, where the straight of an RSL or
+/// LSR path vanishes, and where a CCC path stops being admitted (centers 2 sqrt(3) radii apart), so paths within
+/// tolerance of these are flagged near_switch.
+/// @param path path of any word, with a finite length
+/// @param tolerance distance (in length units) from a discontinuity that is flagged
+/// @return derivatives
+PathGradient path_gradient(const PathDescriptor& path, double tolerance = 1e-6) noexcept;
+
+/// @brief Get the shortest path between two states and its derivatives, see path_gradient(). Paths are also flagged
+/// near_switch when another word is within tolerance of the shortest, where the word of the shortest path changes.
+/// @param start State of the path start
+/// @param end State at the path end
+/// @param radius Turning radius
+/// @param tolerance distance (in length units) from a discontinuity that is flagged
+/// @return derivatives
+PathGradient path_gradient(const State& start, const State& end, double radius, double tolerance = 1e-6) noexcept;
+
+/// @brief Get the shortest paths and their derivatives for many pairs of states, see path_gradient()
+/// @param starts States of the path starts
+/// @param ends States at the path ends, as many as starts
+/// @param radius Turning radius
+/// @param out derivatives, resized to the number of pairs
+/// @param tolerance distance (in length units) from a discontinuity that is flagged
+void path_gradients(const std::vector<State>& starts, const std::vector<State>& ends, double radius,
+                    std::vector<PathGradient>& out, double tolerance = 1e-6);
+
+/// @brief Get the state a fixed distance along a path and its derivatives
+/// @param path path and derivatives from path_gradient()
+/// @param distance distance from the path start, clamped to [0, length]. At the clamp the distance follows the length.
+/// @return state and derivatives
+PoseGradient pose_gradient(const PathGradient& path, double distance) noexcept;
+
+/// @brief Get states at fixed distances along a path and their derivatives, see pose_gradient()
+/// @param path path and derivatives from path_gradient()
+/// @param distances distances from the path start
+/// @param out states and derivatives, resized to the number of distances
+void pose_gradients(const PathGradient& path, const std::vector<double>& distances, std::vector<PoseGradient>& out);
+
+}    // namespace dubins
+
+#endif    // DUBINS_GRADIENT_HPP
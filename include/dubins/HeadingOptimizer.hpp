@@ -0,0 +1,70 @@
+#ifndef DUBINS_HEADING_OPTIMIZER_HPP
+#define DUBINS_HEADING_OPTIMIZER_HPP
+
+#include "dubins/State.hpp"
+#include "dubins/Vector.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace dubins
+{
+/// @brief Object for choosing headings at an ordered list of positions so that the dubins route through them is as
+/// short as possible.
+///
+/// Headings are first chosen by dynamic programming over a set of evenly spaced candidate headings per position, with
+/// the number of candidates doubled each pass. The result of the final pass is then refined continuously, one
+/// position at a time.
+class HeadingOptimizer
+{
+    public:
+    /// @brief Options for optimizing headings
+    struct Options
+    {
+        double       turning_radius{1.0};             ///< Turing radius of Dubins car
+        std::int32_t min_heading_levels{4};           ///< Candidate headings per position in the first pass
+        std::int32_t heading_levels{32};              ///< Candidate headings per position in the final pass
+        std::int32_t refinement_iterations{10};       ///< Maximum number of continuous refinement sweeps
+        double       refinement_tolerance{1.0e-9};    ///< Stop refining once a sweep improves less than this
+        std::size_t  threads{0};                      ///< Worker threads, 0 for one per hardware thread
+    };
+
+    /// @brief Route length achieved by one discretization pass
+    struct Level
+    {
+        std::int32_t heading_levels{0};    ///< Candidate headings per position
+        double       length{0.0};          ///< Length of the best route with these candidates
+    };
+
+    /// @brief Optimize headings for a sequence of positions
+    /// @param points Positions to pass through, in order
+    /// @param options Options for optimizing
+    HeadingOptimizer(const std::vector<Vector2D>& points, const Options& options);
+
+    /// @brief Get the optimized headings, one per position
+    /// @return headings
+    const std::vector<double>& headings() const noexcept;
+
+    /// @brief Get the positions combined with the optimized headings
+    /// @return states
+    std::vector<State> states() const;
+
+    /// @brief Get the length of the route after refinement
+    /// @return length of the route
+    double length() const noexcept;
+
+    /// @brief Get the length achieved by each discretization pass, in order of increasing heading levels
+    /// @return route length per number of heading levels
+    const std::vector<Level>& levels() const noexcept;
+
+    private:
+    std::vector<Vector2D> m_points;       ///< Positions
+    std::vector<double>   m_headings;     ///< Optimized headings
+    std::vector<Level>    m_levels;       ///< Length per discretization pass
+    double                m_length{0.0};  ///< Length after refinement
+};
+
+}    // namespace dubins
+
+#endif    // DUBINS_HEADING_OPTIMIZER_HPP
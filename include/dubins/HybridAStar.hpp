@@ -0,0 +1,93 @@
+#ifndef DUBINS_HYBRID_A_STAR_HPP
+#define DUBINS_HYBRID_A_STAR_HPP
+
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Raster.hpp"
+#include "dubins/State.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace dubins
+{
+/// @brief Result of a successful Hybrid A* search
+struct HybridAStarPlan
+{
+    std::vector<PathDescriptor> segments;       ///< Motion primitives from the start, the last one is the final shot
+    double                      length{0.0};    ///< Total length
+};
+
+/// @brief Counters of the last Hybrid A* search
+struct HybridAStarStatistics
+{
+    std::size_t expansions{0};        ///< Expanded nodes
+    std::size_t shots{0};             ///< Analytic expansions attempted
+    std::size_t rejected_early{0};    ///< Shots rejected by the lower bound, without a collision check
+    std::size_t accepted_broad{0};    ///< Shots accepted because their bounding box is free
+    std::size_t traversals{0};        ///< Shots that needed an exact grid traversal
+    std::size_t cached{0};            ///< Heuristic lookups served from the cache
+};
+
+/// @brief Hybrid A* planner on an occupancy grid. Nodes are continuous states binned into (x, y, heading) cells and
+/// expanded with three constant curvature primitives: full left, straight and full right at the turning radius.
+///
+/// Every few expansions the planner tries a dubins "analytic expansion" shot to the goal. Shots are filtered from cheap
+/// to expensive: a shot shorter than the obstacle-aware grid distance from its start (less the discretization slack of
+/// the grid) can not be free and is rejected without looking at the grid, a shot whose bounding box holds no occupied
+/// cell is accepted from a summed area table in constant time, and only the rest are traversed cell by cell.
+///
+/// The heuristic is the larger of the obstacle-free dubins length and the same discounted grid distance, so it never
+/// overestimates. It is cached per visited bin, so reaching a bin again costs nothing.
+class HybridAStar
+{
+    public:
+    /// @brief Search settings
+    struct Options
+    {
+        double       turning_radius{1.0};       ///< Turning radius
+        std::int32_t headings{72};              ///< Number of heading bins
+        double       step{0.0};                 ///< Arc length of a primitive, 0 for just over one cell diagonal
+        std::size_t  shot_interval{5};          ///< Expansions between shots
+        double       shot_distance{0.0};        ///< Shoot on every expansion when the heuristic is below this
+        std::size_t  max_expansions{100000};    ///< Search budget
+    };
+
+    /// @brief Create a planner
+    /// @param grid grid layout
+    /// @param occupancy row-major occupancy of the grid, width * height entries, non-zero is occupied
+    /// @param options search settings
+    HybridAStar(const Grid& grid, std::vector<std::uint8_t> occupancy, const Options& options);
+
+    /// @brief Plan a path between two states
+    /// @param start State of the path start
+    /// @param goal State at the path end
+    /// @return plan, or empty if no path was found within the search budget
+    std::optional<HybridAStarPlan> plan(const State& start, const State& goal);
+
+    /// @brief Get the counters of the last search
+    /// @return counters
+    const HybridAStarStatistics& statistics() const noexcept;
+
+    /// @brief Check a path against the grid. Paths leaving the grid are not free.
+    /// @param path path
+    /// @return true if the path only passes through free cells
+    bool free(const PathDescriptor& path) const;
+
+    private:
+    std::optional<std::size_t> key(const State& state) const noexcept;
+    bool                       box_free(const Vector2D& min, const Vector2D& max) const noexcept;
+    void                       grid_distance(const State& goal);
+
+    Grid                       m_grid;
+    std::vector<std::uint8_t>  m_occupancy;
+    std::vector<std::uint32_t> m_summed;      ///< Summed area table of the occupancy, (width + 1) * (height + 1)
+    std::vector<double>        m_distance;    ///< Obstacle-aware grid distance from every cell to the goal
+    Options                    m_options;
+    HybridAStarStatistics      m_statistics;
+};
+
+}    // namespace dubins
+
+#endif    // DUBINS_HYBRID_A_STAR_HPP
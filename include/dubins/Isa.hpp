@@ -0,0 +1,51 @@
+#ifndef DUBINS_ISA_HPP
+#define DUBINS_ISA_HPP
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace dubins
+{
+/// @brief Instruction set the vectorized kernels (one_to_many(), calculate_transfer_lines() and
+/// calculate_transfer_circles()) run with
+enum class Isa : std::uint8_t
+{
+    scalar,     ///< One element at a time through the scalar functions, the reference the others are checked against
+    generic,    ///< Vectorized for the instruction set the library was compiled for
+    avx2,       ///< Vectorized for AVX2 and FMA, x86-64 only
+    avx512      ///< Vectorized for AVX-512 (F, DQ, VL and BW), x86-64 only
+};
+
+/// @brief Check if an instruction set can be used, it must be compiled in and supported by the CPU
+/// @param isa instruction set
+/// @return supported (true), or not
+bool isa_supported(Isa isa) noexcept;
+
+/// @brief Set the instruction set used by the library. When the library is loaded it picks default_isa().
+/// @param isa instruction set to use
+/// @return true if the instruction set is supported and now in use, false (and unchanged) otherwise
+bool set_isa(Isa isa) noexcept;
+
+/// @brief Get the instruction set used by the library
+/// @return current instruction set
+Isa isa() noexcept;
+
+/// @brief Get the instruction set the library picks when it is loaded: the one named by the DUBINS_ISA environment
+/// variable (see isa_from_string()) if it is supported, the best supported one otherwise
+/// @return default instruction set
+Isa default_isa() noexcept;
+
+/// @brief Get the name of an instruction set
+/// @param isa instruction set
+/// @return "scalar", "generic", "avx2" or "avx512"
+std::string_view to_string(Isa isa) noexcept;
+
+/// @brief Parse the name of an instruction set, see to_string()
+/// @param name name
+/// @return instruction set, or empty if the name is unknown
+std::optional<Isa> isa_from_string(std::string_view name) noexcept;
+
+}    // namespace dubins
+
+#endif    // DUBINS_ISA_HPP
@@ -0,0 +1,94 @@
+#ifndef DUBINS_MOTION_PRIMITIVES_HPP
+#define DUBINS_MOTION_PRIMITIVES_HPP
+
+#include "dubins/Bounds.hpp"
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Raster.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace dubins
+{
+/// @brief Dubins connection from the origin of a lattice to a neighbouring lattice pose
+struct MotionPrimitive
+{
+    std::int32_t          start_heading{0};    ///< Heading index at the start
+    std::int32_t          dx{0};               ///< Offset of the end along x, in lattice cells
+    std::int32_t          dy{0};               ///< Offset of the end along y, in lattice cells
+    std::int32_t          end_heading{0};      ///< Heading index at the end
+    double                length{0.0};         ///< Length of the path
+    std::array<double, 3> segments{};          ///< Length of each segment of the word
+    Word                  word{Word::LSL};     ///< Word of the path
+    BoundingBox           bounds;              ///< Bounding box of the path, relative to the start position
+    std::uint32_t         cells_begin{0};      ///< First swept cell in MotionPrimitiveTable::cells()
+    std::uint32_t         cells_count{0};      ///< Number of swept cells, 0 when cells are not generated
+};
+
+/// @brief Table of all motion primitives of a state lattice. Lengths are invariant under quarter turns (when the
+/// number of headings is a multiple of 4) and reflections of the lattice, so only one primitive per symmetry class is
+/// solved and the rest are mapped from it. Primitives are stored contiguously, grouped by start heading.
+class MotionPrimitiveTable
+{
+    public:
+    /// @brief Lattice discretization and generation settings
+    struct Options
+    {
+        double       resolution{1.0};                                      ///< Size of a lattice cell
+        std::int32_t range{3};                                             ///< Offsets span [-range, range] cells
+        std::int32_t headings{16};                                         ///< Number of heading indices
+        double       turning_radius{1.0};                                  ///< Turning radius
+        double       max_length{std::numeric_limits<double>::infinity()};  ///< Longer primitives are dropped
+        bool         swept_cells{false};                                   ///< Generate the cells each primitive sweeps
+        std::size_t  threads{1};    ///< Worker threads, 0 for one per hardware thread
+    };
+
+    /// @brief Create an empty table
+    MotionPrimitiveTable() = default;
+
+    /// @brief Generate the primitives of a lattice
+    /// @param options lattice discretization
+    explicit MotionPrimitiveTable(const Options& options);
+
+    /// @brief Get all primitives, grouped by start heading
+    /// @return primitives
+    const std::vector<MotionPrimitive>& primitives() const noexcept;
+
+    /// @brief Get the primitives leaving a heading, for expanding a lattice node
+    /// @param start_heading heading index
+    /// @return range [first, last) of primitives
+    std::pair<const MotionPrimitive*, const MotionPrimitive*> from_heading(std::int32_t start_heading) const noexcept;
+
+    /// @brief Get the cells swept by a primitive, as offsets from the start cell. Cell (0, 0) is centered on the start.
+    /// @param primitive primitive of this table
+    /// @return range [first, last) of cells, empty when swept cells were not generated
+    std::pair<const Cell*, const Cell*> cells(const MotionPrimitive& primitive) const noexcept;
+
+    /// @brief Get the path of a primitive
+    /// @param primitive primitive of this table
+    /// @return path starting at the origin
+    PathDescriptor path(const MotionPrimitive& primitive) const noexcept;
+
+    /// @brief Number of primitives that were actually solved, the rest follow by symmetry
+    /// @return number of solved primitives
+    std::size_t solved_count() const noexcept;
+
+    /// @brief Get the options the table was generated with
+    /// @return options
+    const Options& options() const noexcept;
+
+    private:
+    Options                      m_options;
+    std::vector<MotionPrimitive> m_primitives;
+    std::vector<std::size_t>     m_heading_offsets{0};    ///< Prefix offsets into m_primitives per start heading
+    std::vector<Cell>            m_cells;
+    std::size_t                  m_solved{0};
+};
+
+}    // namespace dubins
+
+#endif    // DUBINS_MOTION_PRIMITIVES_HPP
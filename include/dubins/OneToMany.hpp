@@ -0,0 +1,49 @@
+#ifndef DUBINS_ONE_TO_MANY_HPP
+#define DUBINS_ONE_TO_MANY_HPP
+
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/State.hpp"
+
+#include <vector>
+
+namespace dubins
+{
+/// @brief Solve for the shortest path lengths from one start to many goals.
+///
+/// Goals are moved into the frame of the start and scaled by the turning radius once, where the start's turning
+/// circles are fixed at (0, +-1). All six words are then evaluated in closed form without branches, so the loop over
+/// goals vectorizes when TrigMode::approximate is selected.
+/// @param start State of the path start
+/// @param goals States at the path ends
+/// @param radius Turning radius
+/// @param out lengths, resized to the number of goals
+void one_to_many(const State& start, const std::vector<State>& goals, double radius, std::vector<double>& out);
+
+/// @brief Solve for the shortest paths from one start to many goals, see one_to_many(). Each path is written whole,
+/// so unlike the lengths the loop over goals is not vectorized.
+/// @param start State of the path start
+/// @param goals States at the path ends
+/// @param radius Turning radius
+/// @param out paths, resized to the number of goals
+void one_to_many(const State& start, const std::vector<State>& goals, double radius,
+                 std::vector<PathDescriptor>& out);
+
+/// @brief Solve for the shortest path lengths from many starts to one goal. A path driven backwards is a path between
+/// the reversed states, so this is one_to_many() from the reversed goal.
+/// @param starts States of the path starts
+/// @param goal State at the path end
+/// @param radius Turning radius
+/// @param out lengths, resized to the number of starts
+void many_to_one(const std::vector<State>& starts, const State& goal, double radius, std::vector<double>& out);
+
+/// @brief Solve for the shortest paths from many starts to one goal, see many_to_one()
+/// @param starts States of the path starts
+/// @param goal State at the path end
+/// @param radius Turning radius
+/// @param out paths, resized to the number of starts
+void many_to_one(const std::vector<State>& starts, const State& goal, double radius,
+                 std::vector<PathDescriptor>& out);
+
+}    // namespace dubins
+
+#endif    // DUBINS_ONE_TO_MANY_HPP
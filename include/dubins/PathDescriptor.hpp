@@ -0,0 +1,193 @@
+#ifndef DUBINS_PATH_DESCRIPTOR_HPP
+#define DUBINS_PATH_DESCRIPTOR_HPP
+
+#include "dubins/Circle.hpp"
+#include "dubins/State.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace dubins
+{
+/// @brief Word (sequence of segment types) of a dubins path
+enum class Word : std::uint8_t
+{
+    LSL,
+    RSR,
+    RSL,
+    LSR,
+    LRL,
+    RLR
+};
+
+/// @brief Type of a single path segment
+enum class SegmentType : std::uint8_t
+{
+    left,        ///< Counter-clockwise arc
+    straight,    ///< Straight line
+    right        ///< Clockwise arc
+};
+
+/// @brief Get the segment types making up a word
+/// @param word word
+/// @return segment types, in order of travel
+constexpr std::array<SegmentType, 3> segment_types(Word word) noexcept
+{
+    constexpr auto L = SegmentType::left;
+    constexpr auto S = SegmentType::straight;
+    constexpr auto R = SegmentType::right;
+
+    switch (word)
+    {
+        case Word::LSL: return {L, S, L};
+        case Word::RSR: return {R, S, R};
+        case Word::RSL: return {R, S, L};
+        case Word::LSR: return {L, S, R};
+        case Word::LRL: return {L, R, L};
+        case Word::RLR: return {R, L, R};
+    }
+    return {S, S, S};
+}
+
+/// @brief Compact description of a solved dubins path. Unlike Dubins it holds no heap data, it is trivially copyable
+/// and fits in one cache line, so large numbers of paths can be stored contiguously or copied around freely.
+struct PathDescriptor
+{
+    State                 start{{0.0, 0.0}, 0.0};    ///< State at the start of the path
+    double                radius{1.0};               ///< Turning radius
+    std::array<double, 3> segments{};                ///< Length of each segment (arc length for turns)
+    Word                  word{Word::LSL};           ///< Word of the path
+};
+
+static_assert(std::is_trivially_copyable_v<PathDescriptor>, "PathDescriptor must be trivially copyable");
+static_assert(sizeof(PathDescriptor) <= 64, "PathDescriptor must fit in a cache line");
+
+/// @brief Number of bytes in the encoded form of a path descriptor
+constexpr std::size_t encoded_descriptor_size = 57;
+
+/// @brief Encode a path descriptor into a stable, platform independent byte layout: start x, start y, start heading,
+/// radius and the three segment lengths as little-endian IEEE-754 doubles, followed by the word as a single byte.
+/// @param path path
+/// @return encoded bytes
+std::array<std::uint8_t, encoded_descriptor_size> encode(const PathDescriptor& path) noexcept;
+
+/// @brief Decode a path descriptor encoded with encode()
+/// @param data encoded bytes, encoded_descriptor_size bytes are read
+/// @return path descriptor, or empty if the word is invalid
+std::optional<PathDescriptor> decode(const std::uint8_t* data) noexcept;
+
+/// @brief Solve for the shortest path between two states
+/// @param start State of the path start
+/// @param end State at the path end
+/// @param radius Turning radius
+/// @return Descriptor of the shortest path
+PathDescriptor shortest_path(const State& start, const State& end, double radius) noexcept;
+
+/// @brief Turning circles of a state. Precompute these when a state takes part in many queries.
+struct TurningCircles
+{
+    State     state{{0.0, 0.0}, 0.0};            ///< State the circles belong to
+    CircleCCW left{Circle{{0.0, 0.0}, 1.0}};     ///< Circle for turning left
+    CircleCW  right{Circle{{0.0, 0.0}, 1.0}};    ///< Circle for turning right
+};
+
+/// @brief Get the turning circles of a state
+/// @param state State
+/// @param radius Turning radius
+/// @return turning circles
+TurningCircles turning_circles(const State& state, double radius) noexcept;
+
+/// @brief Solve for the shortest path between two states with precomputed turning circles
+/// @param start Turning circles of the path start
+/// @param end Turning circles of the path end, must have the same radius as start
+/// @return Descriptor of the shortest path
+PathDescriptor shortest_path(const TurningCircles& start, const TurningCircles& end) noexcept;
+
+/// @brief Solve for the path of a single word
+/// @param start State of the path start
+/// @param end State at the path end
+/// @param radius Turning radius
+/// @param word Word of the path
+/// @return Descriptor of the path, with an infinite length if the word has no solution
+PathDescriptor word_path(const State& start, const State& end, double radius, Word word) noexcept;
+
+/// @brief Solve for the path of a single word with precomputed turning circles
+/// @param start Turning circles of the path start
+/// @param end Turning circles of the path end, must have the same radius as start
+/// @param word Word of the path
+/// @return Descriptor of the path, with an infinite length if the word has no solution
+PathDescriptor word_path(const TurningCircles& start, const TurningCircles& end, Word word) noexcept;
+
+/// @brief Get the length of a path
+/// @param path path
+/// @return length of the path
+inline double length(const PathDescriptor& path) noexcept
+{
+    return path.segments[0] + path.segments[1] + path.segments[2];
+}
+
+/// @brief Get the state after travelling a distance along a path
+/// @param path path
+/// @param distance distance from the path start, clamped to [0, length]
+/// @return state, heading in [-pi, pi)
+State state_at(const PathDescriptor& path, double distance) noexcept;
+
+/// @brief Move a distance along a single segment
+/// @param from state at the start of the segment
+/// @param type type of the segment
+/// @param radius turning radius
+/// @param distance distance to travel
+/// @return state after travelling, heading is not wrapped
+State advance(const State& from, SegmentType type, double radius, double distance) noexcept;
+
+/// @brief Get the states at the start of each segment
+/// @param path path
+/// @return states at the start of each of the three segments followed by the end state. Headings are not wrapped.
+std::array<State, 4> segment_boundaries(const PathDescriptor& path) noexcept;
+
+/// @brief Get the state at the end of a path
+/// @param path path
+/// @return state, heading in [-pi, pi)
+State end_state(const PathDescriptor& path) noexcept;
+
+/// @brief Append evenly spaced states along a path
+/// @param path path
+/// @param first distance of the first state from the path start
+/// @param spacing distance between states
+/// @param count number of states to append
+/// @param out states are appended to this vector
+void sample(const PathDescriptor& path, double first, double spacing, std::size_t count,
+            std::vector<State>& out);
+
+/// @brief Append evenly spaced states along a path to a vector using a memory resource
+/// @param path path
+/// @param first distance of the first state from the path start
+/// @param spacing distance between states
+/// @param count number of states to append
+/// @param out states are appended to this vector, growing it allocates from its memory resource
+void sample(const PathDescriptor& path, double first, double spacing, std::size_t count,
+            std::pmr::vector<State>& out);
+
+/// @brief Append the fewest states along a path that keep the polyline through them within a maximum distance of the
+/// path. Straight segments contribute only their end state, arcs are split into chords of equal angle. The path start
+/// is not appended, so consecutive paths can be chained without duplicates.
+/// @param path path
+/// @param max_chord_error maximum distance between a chord and the arc it replaces, nothing is appended unless positive
+/// @param out states are appended to this vector
+void sample_adaptive(const PathDescriptor& path, double max_chord_error, std::vector<State>& out);
+
+/// @brief Append the fewest states along a path that keep the polyline through them within a maximum distance of the
+/// path, see sample_adaptive()
+/// @param path path
+/// @param max_chord_error maximum distance between a chord and the arc it replaces, nothing is appended unless positive
+/// @param out states are appended to this vector, growing it allocates from its memory resource
+void sample_adaptive(const PathDescriptor& path, double max_chord_error, std::pmr::vector<State>& out);
+
+}    // namespace dubins
+
+#endif    // DUBINS_PATH_DESCRIPTOR_HPP
@@ -0,0 +1,55 @@
+#ifndef DUBINS_PRIMITIVE_HPP
+#define DUBINS_PRIMITIVE_HPP
+
+#include "dubins/Line.hpp"
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Vector.hpp"
+
+#include <array>
+#include <cmath>
+#include <variant>
+
+namespace dubins
+{
+/// @brief Circular arc of a path
+struct ArcPrimitive
+{
+    Vector2D    center{0.0, 0.0};               ///< Center of the turning circle
+    double      radius{1.0};                    ///< Radius of the turning circle
+    double      start_angle{0.0};               ///< Angle of the arc start on the circle, [0, 2pi)
+    double      end_angle{0.0};                 ///< Angle of the arc end on the circle, [0, 2pi)
+    double      sweep{0.0};                     ///< Angle travelled, positive counter-clockwise, in (-2pi, 2pi)
+    SegmentType direction{SegmentType::left};    ///< Direction of travel, left (counter-clockwise) or right (clockwise)
+};
+
+/// @brief Length of an arc
+/// @param arc Arc
+/// @return length
+inline double length(const ArcPrimitive& arc) noexcept
+{
+    return arc.radius * std::abs(arc.sweep);
+}
+
+/// @brief Geometric primitive of a path, an arc or a line from a to b
+using Primitive = std::variant<ArcPrimitive, Line2D>;
+
+/// @brief The three primitives of a path in order of travel. Segments of zero length are kept as degenerate primitives
+/// (zero sweep or coincident line end points) so the index matches the segment index of the word.
+using Primitives = std::array<Primitive, 3>;
+
+/// @brief Get the geometric primitives of a path
+/// @param path path
+/// @return primitives, in order of travel
+Primitives primitives(const PathDescriptor& path) noexcept;
+
+/// @brief Length of a primitive
+/// @param primitive Primitive
+/// @return length
+inline double length(const Primitive& primitive) noexcept
+{
+    return std::visit([](const auto& p) { return length(p); }, primitive);
+}
+
+}    // namespace dubins
+
+#endif    // DUBINS_PRIMITIVE_HPP
@@ -0,0 +1,53 @@
+#ifndef DUBINS_PROJECTION_HPP
+#define DUBINS_PROJECTION_HPP
+
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Vector.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace dubins
+{
+/// @brief Closest point on a path
+struct Projection
+{
+    double arc_length{0.0};    ///< Distance along the path to the closest point
+    double distance{0.0};      ///< Distance between the projected point and the path
+};
+
+/// @brief Find the closest point on a path. Each arc and line is projected onto analytically.
+/// @param path path
+/// @param point point to project
+/// @return closest point. Ties are resolved towards the start of the path.
+Projection project(const PathDescriptor& path, const Vector2D& point) noexcept;
+
+/// @brief Find the closest point on a path within a window around a previous result. Use this for tracking, it keeps
+/// the result from jumping between parts of a path that pass close to each other.
+/// @param path path
+/// @param point point to project
+/// @param previous arc length of the previous projection
+/// @param window only arc lengths within +-window of previous are considered
+/// @return closest point within the window
+Projection project(const PathDescriptor& path, const Vector2D& point, double previous, double window) noexcept;
+
+/// @brief Project many points, each onto its own path
+/// @param paths paths
+/// @param points points to project, one per path
+/// @param out projections, resized to the number of paths
+/// @param threads worker threads, 0 for one per hardware thread
+void project(const std::vector<PathDescriptor>& paths, const std::vector<Vector2D>& points,
+             std::vector<Projection>& out, std::size_t threads = 1);
+
+/// @brief Project many points, each onto its own path, warm started from previous projections
+/// @param paths paths
+/// @param points points to project, one per path
+/// @param window only arc lengths within +-window of the previous projection are considered
+/// @param inout previous projections on input, new projections on output
+/// @param threads worker threads, 0 for one per hardware thread
+void project(const std::vector<PathDescriptor>& paths, const std::vector<Vector2D>& points, double window,
+             std::vector<Projection>& inout, std::size_t threads = 1);
+
+}    // namespace dubins
+
+#endif    // DUBINS_PROJECTION_HPP
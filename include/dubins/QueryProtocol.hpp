@@ -0,0 +1,92 @@
+#ifndef DUBINS_QUERY_PROTOCOL_HPP
+#define DUBINS_QUERY_PROTOCOL_HPP
+
+#include "dubins/State.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace dubins
+{
+/// Wire format of the query server (see QueryServer). Clients write fixed size requests and read variable size
+/// responses on a stream socket, all numbers little-endian, doubles as IEEE 754 bit patterns.
+///
+/// Request, query_request_size bytes:
+///   u32 id | u8 type | f64 start x, y, heading | f64 end x, y, heading | f64 radius | f64 spacing
+///
+/// Response, query_response_header_size + 24 * count bytes:
+///   u32 id | u8 status | f64 length | u32 count | count * (f64 x, y, heading)
+///
+/// Responses carry the id of their request. Requests on one connection may be answered out of order.
+
+/// @brief Kind of query
+enum class QueryType : std::uint8_t
+{
+    length  = 1,    ///< Length of the shortest path
+    samples = 2     ///< Length and evenly spaced states along the shortest path, start and end included
+};
+
+/// @brief Outcome of a query
+enum class QueryStatus : std::uint8_t
+{
+    ok      = 0,    ///< Answered
+    invalid = 1     ///< Non-finite states, radius or spacing not positive, or too many samples
+};
+
+/// @brief Query sent to the server
+struct QueryRequest
+{
+    std::uint32_t id{0};                      ///< Chosen by the client, returned in the response
+    QueryType     type{QueryType::length};    ///< Kind of query
+    State         start;                      ///< State of the path start
+    State         end;                        ///< State at the path end
+    double        radius{1.0};                ///< Turning radius
+    double        spacing{0.1};               ///< Largest distance between samples, ignored by length queries
+};
+
+/// @brief Answer to a query
+struct QueryResponse
+{
+    std::uint32_t      id{0};                      ///< Id of the request
+    QueryStatus        status{QueryStatus::ok};    ///< Outcome
+    double             length{0.0};                ///< Length of the shortest path
+    std::vector<State> samples;                    ///< States along the path, for sample queries
+};
+
+constexpr std::size_t   query_request_size         = 69;          ///< Bytes in an encoded request
+constexpr std::size_t   query_response_header_size = 17;          ///< Bytes in a response before the samples
+constexpr std::size_t   query_sample_size          = 24;          ///< Bytes per sample in a response
+constexpr std::uint32_t max_response_samples       = 1u << 24;    ///< Largest sample count a response may hold
+
+/// @brief Encode a request
+/// @param request request
+/// @return encoded request
+std::array<std::uint8_t, query_request_size> encode(const QueryRequest& request) noexcept;
+
+/// @brief Decode a request
+/// @param data query_request_size bytes
+/// @return request, or empty if the query type is unknown
+std::optional<QueryRequest> decode_request(const std::uint8_t* data) noexcept;
+
+/// @brief Append an encoded response to a buffer
+/// @param response response
+/// @param out bytes are appended to this vector
+void encode(const QueryResponse& response, std::vector<std::uint8_t>& out);
+
+/// @brief Get the size of a response from its header
+/// @param header query_response_header_size bytes
+/// @return total size of the response in bytes, or 0 if the header is not valid
+std::size_t response_size(const std::uint8_t* header) noexcept;
+
+/// @brief Decode a response
+/// @param data response_size() bytes
+/// @param size number of bytes
+/// @return response, or empty if the data is not a valid response
+std::optional<QueryResponse> decode_response(const std::uint8_t* data, std::size_t size);
+
+}    // namespace dubins
+
+#endif    // DUBINS_QUERY_PROTOCOL_HPP
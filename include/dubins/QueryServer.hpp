@@ -0,0 +1,133 @@
+#ifndef DUBINS_QUERY_SERVER_HPP
+#define DUBINS_QUERY_SERVER_HPP
+
+#include "dubins/QueryProtocol.hpp"
+#include "dubins/State.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace dubins
+{
+/// @brief Query server shared by the processes on a host, listening on a Unix domain socket (see QueryProtocol.hpp
+/// for the wire format).
+///
+/// Each connection has a reader thread that queues its requests. A single batching thread takes everything queued
+/// once the oldest request has waited max_latency, or as soon as max_batch requests are waiting, and answers the batch
+/// in one go: queries sharing a start and radius are solved together with one_to_many(), the batch is split over a pool
+/// of worker threads kept for the life of the server, and the responses are written back to their connections. Only
+/// POSIX systems are supported.
+class QueryServer
+{
+    public:
+    /// @brief Server settings
+    struct Options
+    {
+        std::string               socket_path;             ///< Path of the socket, see start()
+        std::size_t               threads{0};              ///< Worker threads, 0 for one per hardware thread
+        std::size_t               max_batch{4096};         ///< Requests that trigger a batch without waiting
+        std::chrono::microseconds max_latency{200};        ///< Longest a request waits for its batch to fill
+        std::size_t               max_samples{1000000};    ///< Largest number of samples in one response
+    };
+
+    /// @brief Counters since the server started
+    struct Metrics
+    {
+        std::uint64_t requests{0};             ///< Requests answered
+        std::uint64_t invalid{0};              ///< Requests answered with QueryStatus::invalid
+        std::uint64_t batches{0};              ///< Batches evaluated
+        std::uint64_t connections{0};          ///< Connections accepted
+        double        mean_batch_size{0.0};    ///< Requests per batch
+        double        throughput{0.0};         ///< Requests answered per second
+        double        latency_p50{0.0};        ///< Median time from receipt to response of recent requests, seconds
+        double        latency_p99{0.0};        ///< 99th percentile time from receipt to response, seconds
+        double        latency_max{0.0};        ///< Longest time from receipt to response of recent requests, seconds
+    };
+
+    /// @brief Bind the socket and start serving. A socket left at the path by a server that exited is replaced, a
+    /// socket another server still listens on or a file that is not a socket is not.
+    /// @param options server settings
+    /// @return running server, or empty if the socket could not be created
+    static std::optional<QueryServer> start(const Options& options);
+
+    /// @brief Stop serving, see stop()
+    ~QueryServer();
+
+    QueryServer(QueryServer&& other) noexcept;
+    QueryServer& operator=(QueryServer&& other) noexcept;
+
+    /// @brief Stop accepting, answer the requests already queued, close every connection and remove the socket file
+    /// unless another server has replaced it
+    void stop();
+
+    /// @brief Get the counters
+    /// @return counters since the server started
+    Metrics metrics() const;
+
+    /// @brief Get the options the server was started with
+    /// @return options
+    const Options& options() const noexcept;
+
+    private:
+    class Impl;
+
+    explicit QueryServer(std::unique_ptr<Impl> impl) noexcept;
+
+    std::unique_ptr<Impl> m_impl;
+};
+
+/// @brief Connection to a QueryServer. Requests can be pipelined: send() many, then receive() their responses. The
+/// blocking length() and samples() expect no pipelined responses to be outstanding.
+class QueryClient
+{
+    public:
+    /// @brief Connect to a server
+    /// @param socket_path path of the server socket
+    /// @return connected client, or empty if the server could not be reached
+    static std::optional<QueryClient> connect(const std::string& socket_path);
+
+    /// @brief Close the connection
+    ~QueryClient();
+
+    QueryClient(QueryClient&& other) noexcept;
+    QueryClient& operator=(QueryClient&& other) noexcept;
+
+    /// @brief Send a request without waiting for its response
+    /// @param request request
+    /// @return true if the request was written
+    bool send(const QueryRequest& request);
+
+    /// @brief Wait for the next response
+    /// @return response, or empty if the connection closed
+    std::optional<QueryResponse> receive();
+
+    /// @brief Get the length of a shortest path, waiting for the response
+    /// @param start State of the path start
+    /// @param end State at the path end
+    /// @param radius Turning radius
+    /// @return length, or empty if the server failed or rejected the query
+    std::optional<double> length(const State& start, const State& end, double radius);
+
+    /// @brief Get states along a shortest path, waiting for the response
+    /// @param start State of the path start
+    /// @param end State at the path end
+    /// @param radius Turning radius
+    /// @param spacing largest distance between states
+    /// @return states, start and end included, or empty if the server failed or rejected the query
+    std::optional<std::vector<State>> samples(const State& start, const State& end, double radius, double spacing);
+
+    private:
+    explicit QueryClient(int fd) noexcept;
+
+    int           m_fd{-1};
+    std::uint32_t m_next_id{0};    ///< Id of the next blocking query
+};
+
+}    // namespace dubins
+
+#endif    // DUBINS_QUERY_SERVER_HPP
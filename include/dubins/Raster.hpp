@@ -0,0 +1,76 @@
+#ifndef DUBINS_RASTER_HPP
+#define DUBINS_RASTER_HPP
+
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Vector.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace dubins
+{
+/// @brief Regular grid of square cells. Cell (x, y) covers [origin + (x, y) * resolution, origin + (x + 1, y + 1) *
+/// resolution).
+struct Grid
+{
+    Vector2D     origin{0.0, 0.0};    ///< Position of the lower corner of cell (0, 0)
+    double       resolution{1.0};     ///< Side length of a cell
+    std::int32_t width{0};            ///< Number of cells along x
+    std::int32_t height{0};           ///< Number of cells along y
+};
+
+/// @brief Index of a grid cell
+struct Cell
+{
+    std::int32_t x{0};    ///< Column
+    std::int32_t y{0};    ///< Row
+};
+
+/// @brief Equality of two cells
+/// @param lhs Cell
+/// @param rhs Cell
+/// @return equal (true), or not
+inline bool operator==(const Cell& lhs, const Cell& rhs) noexcept
+{
+    return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+/// @brief Inequality of two cells
+/// @param lhs Cell
+/// @param rhs Cell
+/// @return not equal (true), or equal
+inline bool operator!=(const Cell& lhs, const Cell& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+/// @brief Callback for visited cells, return false to stop the traversal
+using CellVisitor = std::function<bool(const Cell&)>;
+
+/// @brief Walk the cells a path passes through. Lines are traversed Amanatides-Woo style, arcs by their exact crossings
+/// with the grid lines, so no cell is missed. Cells are visited in order of travel and each cell is visited once, cells
+/// outside the grid are skipped.
+/// @param path path
+/// @param grid grid
+/// @param visit called for each cell
+/// @return true if the whole path was traversed, false if the visitor stopped it
+bool traverse(const PathDescriptor& path, const Grid& grid, const CellVisitor& visit);
+
+/// @brief Get the cells a path passes through, see traverse()
+/// @param path path
+/// @param grid grid
+/// @return cells, in order of travel
+std::vector<Cell> rasterize(const PathDescriptor& path, const Grid& grid);
+
+/// @brief Find the first occupied cell along a path, the traversal stops there
+/// @param path path
+/// @param grid grid
+/// @param occupancy row-major occupancy of the grid, width * height entries, non-zero is occupied
+/// @return first occupied cell, or empty if the path is free
+std::optional<Cell> first_occupied(const PathDescriptor& path, const Grid& grid, const std::uint8_t* occupancy);
+
+}    // namespace dubins
+
+#endif    // DUBINS_RASTER_HPP
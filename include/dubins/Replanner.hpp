@@ -0,0 +1,83 @@
+#ifndef DUBINS_REPLANNER_HPP
+#define DUBINS_REPLANNER_HPP
+
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/State.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace dubins
+{
+/// @brief Object for repeatedly solving the shortest path while the start and/or end state drift.
+///
+/// Each update re-evaluates only the previously optimal word. The other words are kept as lower bounds, derived from
+/// their lengths at the last full evaluation and a bound on how fast each word's length can change as the turning
+/// circles move. All six words are only re-evaluated when one of these lower bounds drops below the length of the
+/// current word.
+class Replanner
+{
+    public:
+    /// @brief Solve the initial shortest path
+    /// @param start State of the path start
+    /// @param end State at the path end
+    /// @param radius Turning radius
+    Replanner(const State& start, const State& end, double radius) noexcept;
+
+    /// @brief Move the start state
+    /// @param start new start state
+    /// @return true if the optimal word changed
+    bool update_start(const State& start) noexcept;
+
+    /// @brief Move the end state
+    /// @param end new end state
+    /// @return true if the optimal word changed
+    bool update_end(const State& end) noexcept;
+
+    /// @brief Move both states
+    /// @param start new start state
+    /// @param end new end state
+    /// @return true if the optimal word changed
+    bool update(const State& start, const State& end) noexcept;
+
+    /// @brief Get the current shortest path
+    /// @return shortest path
+    const PathDescriptor& path() const noexcept;
+
+    /// @brief Get the length of the current shortest path
+    /// @return length
+    double length() const noexcept;
+
+    /// @brief Get the word of the current shortest path
+    /// @return word
+    Word word() const noexcept;
+
+    /// @brief Get the number of times all six words were evaluated, including construction
+    /// @return number of full evaluations
+    std::size_t full_evaluations() const noexcept;
+
+    private:
+    /// @brief Evaluate all words and reset the reference states
+    void evaluate_all() noexcept;
+
+    /// @brief Lower bound of a word's current length
+    /// @param idx word index
+    /// @param drift bound on how far any turning circle center moved since the last full evaluation
+    /// @return lower bound
+    double lower_bound(std::size_t idx, double drift) const noexcept;
+
+    double                m_radius{1.0};              ///< Turning radius
+    State                 m_start;                    ///< Current start state
+    State                 m_end;                      ///< Current end state
+    State                 m_ref_start;                ///< Start state at the last full evaluation
+    State                 m_ref_end;                  ///< End state at the last full evaluation
+    std::array<double, 6> m_lengths{};                ///< Word lengths at the last full evaluation
+    std::array<double, 6> m_distances{};              ///< Turning circle center distances at the last full evaluation
+    std::array<double, 6> m_max_arc{};                ///< Largest arc angle of each word at the last full evaluation
+    PathDescriptor        m_path;                     ///< Current shortest path
+    std::size_t           m_full_evaluations{0};      ///< Number of full evaluations
+};
+
+}    // namespace dubins
+
+#endif    // DUBINS_REPLANNER_HPP
@@ -0,0 +1,129 @@
+#ifndef DUBINS_ROADMAP_HPP
+#define DUBINS_ROADMAP_HPP
+
+#include "dubins/Bounds.hpp"
+#include "dubins/Circle.hpp"
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/State.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace dubins
+{
+/// @brief Check a path against circular obstacles. Obstacles whose bounding box misses the path's are skipped, the rest
+/// are tested exactly by projecting their center onto the path.
+/// @param path path
+/// @param obstacles obstacles
+/// @return true if the path passes through the interior of any obstacle
+bool collides(const PathDescriptor& path, const std::vector<Circle>& obstacles) noexcept;
+
+/// @brief Directed roadmap edge. The path is stored as its word and single precision segment lengths, the start is the
+/// node the edge leaves.
+struct RoadmapEdge
+{
+    std::uint32_t        to{0};              ///< Node the edge arrives at
+    std::array<float, 3> segments{};         ///< Length of each segment of the word
+    Word                 word{Word::LSL};    ///< Word of the path
+
+    /// @brief Get the length of the edge
+    /// @return length of the path
+    double length() const noexcept { return double(segments[0]) + double(segments[1]) + double(segments[2]); }
+};
+
+/// @brief Shortest route through a roadmap
+struct RoadmapPath
+{
+    std::vector<std::uint32_t> nodes;                                          ///< Nodes from start to goal
+    double                     length{std::numeric_limits<double>::infinity()};    ///< Length, infinite if unreachable
+};
+
+/// @brief Probabilistic roadmap with dubins connections. Every node is connected to its k nearest neighbours by path
+/// length whose paths are collision free. Neighbours are found by searching a uniform grid ring by ring, which can
+/// stop as soon as the k-th best path is shorter than the straight line distance to the next ring. Nodes are
+/// connected in parallel and the edges are stored as a compressed sparse row graph.
+class Roadmap
+{
+    public:
+    /// @brief Sampling and connection settings
+    struct Options
+    {
+        BoundingBox   region{{0.0, 0.0}, {1.0, 1.0}};                        ///< Area nodes are sampled in
+        std::size_t   nodes{1000};                                           ///< Number of sampled nodes
+        std::size_t   neighbours{10};                                        ///< Edges attempted per node
+        double        turning_radius{1.0};                                   ///< Turning radius
+        double        max_length{std::numeric_limits<double>::infinity()};  ///< Longer connections are not attempted
+        std::uint32_t seed{0};                                               ///< Seed of the sampler
+        std::size_t   threads{1};    ///< Worker threads connecting nodes, 0 for one per hardware thread
+    };
+
+    /// @brief Create an empty roadmap
+    Roadmap() = default;
+
+    /// @brief Sample collision free nodes uniformly in position and heading and connect them
+    /// @param options sampling and connection settings
+    /// @param obstacles circular obstacles
+    explicit Roadmap(const Options& options, const std::vector<Circle>& obstacles = {});
+
+    /// @brief Connect given nodes, options.region, options.nodes and options.seed are ignored
+    /// @param nodes nodes of the roadmap
+    /// @param options connection settings
+    /// @param obstacles circular obstacles
+    Roadmap(std::vector<State> nodes, const Options& options, const std::vector<Circle>& obstacles = {});
+
+    /// @brief Find the shortest route between two nodes with A*. The length of the direct dubins path to the goal is
+    /// a lower bound on any route, which makes it an admissible heuristic.
+    /// @param start start node
+    /// @param goal goal node
+    /// @return route, with no nodes if the goal is unreachable
+    RoadmapPath query(std::uint32_t start, std::uint32_t goal) const;
+
+    /// @brief Get the paths along a route
+    /// @param route route returned by query()
+    /// @return path of every edge of the route
+    std::vector<PathDescriptor> paths(const RoadmapPath& route) const;
+
+    /// @brief Get the path of an edge
+    /// @param from node the edge leaves
+    /// @param edge edge
+    /// @return path
+    PathDescriptor path(std::uint32_t from, const RoadmapEdge& edge) const noexcept;
+
+    /// @brief Get the edges leaving a node
+    /// @param node node
+    /// @return range [first, last) of edges
+    std::pair<const RoadmapEdge*, const RoadmapEdge*> edges(std::uint32_t node) const noexcept;
+
+    /// @brief Get the state of a node
+    /// @param node node
+    /// @return state
+    const State& node(std::uint32_t node) const noexcept;
+
+    /// @brief Get the number of nodes
+    /// @return number of nodes
+    std::size_t size() const noexcept;
+
+    /// @brief Get the number of edges
+    /// @return number of edges
+    std::size_t edge_count() const noexcept;
+
+    /// @brief Get the options the roadmap was built with
+    /// @return options
+    const Options& options() const noexcept;
+
+    private:
+    void connect(const std::vector<Circle>& obstacles);
+
+    Options                    m_options;
+    std::vector<State>         m_nodes;
+    std::vector<std::uint64_t> m_offsets{0};    ///< Prefix offsets into m_edges per node
+    std::vector<RoadmapEdge>   m_edges;
+};
+
+}    // namespace dubins
+
+#endif    // DUBINS_ROADMAP_HPP
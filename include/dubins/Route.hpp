@@ -0,0 +1,83 @@
+#ifndef DUBINS_ROUTE_HPP
+#define DUBINS_ROUTE_HPP
+
+#include "dubins/Dubins.hpp"
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/State.hpp"
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace dubins
+{
+/// @brief Object chaining dubins shortest paths (legs) through a sequence of states
+class DubinsRoute
+{
+    public:
+    /// @brief Create an empty route
+    DubinsRoute() noexcept = default;
+
+    /// @brief Create a route through waypoints
+    /// @param waypoints States to pass through, in order
+    /// @param options Options for generating path, only the turning radius is used
+    DubinsRoute(const std::vector<State>& waypoints, const Dubins::Options& options);
+
+    /// @brief Recalculate the route through new waypoints, reusing the existing storage
+    /// @param waypoints States to pass through, in order
+    /// @param options Options for generating path, only the turning radius is used
+    void rebuild(const std::vector<State>& waypoints, const Dubins::Options& options);
+
+    /// @brief Get the total length of the route
+    /// @return length of the route
+    double length() const noexcept;
+
+    /// @brief Get the number of legs in the route
+    /// @return number of legs
+    std::size_t size() const noexcept;
+
+    /// @brief Get a leg of the route
+    /// @param idx index of the leg
+    /// @return leg
+    const PathDescriptor& leg(std::size_t idx) const noexcept;
+
+    /// @brief Get the distance from the route start to the start of a leg
+    /// @param idx index of the leg, size() gives the route length
+    /// @return distance to the leg start
+    double leg_offset(std::size_t idx) const noexcept;
+
+    /// @brief Find the leg a distance along the route falls into, O(log n)
+    /// @param distance distance from the route start, clamped to [0, length]
+    /// @return index of the leg
+    std::size_t leg_index(double distance) const noexcept;
+
+    /// @brief Get the state after travelling a distance along the route
+    /// @param distance distance from the route start, clamped to [0, length]
+    /// @return state
+    State state_at(double distance) const noexcept;
+
+    /// @brief Get the whole route seperated into evenly spaced segments. Spacing is continuous across legs.
+    /// @param options Options for generating path
+    std::vector<State> segmented_path(const Dubins::Options& options) const;
+
+    /// @brief Get the whole route seperated into evenly spaced segments, allocated from a memory resource
+    /// @param options Options for generating path
+    /// @param resource Memory resource for the returned states
+    std::pmr::vector<State> segmented_path(const Dubins::Options& options, std::pmr::memory_resource* resource) const;
+
+    /// @brief Get the fewest states along the route that keep the polyline through them within a maximum distance of
+    /// the route, see dubins::adaptive_path()
+    /// @param max_chord_error maximum distance between the polyline and the route, empty result unless positive
+    std::vector<State> adaptive_path(double max_chord_error) const;
+
+    private:
+    template<typename Segments>
+    void segmented_path_impl(const Dubins::Options& options, Segments& segments) const;
+
+    std::vector<PathDescriptor> m_legs;         ///< Legs between consecutive waypoints
+    std::vector<double>         m_offsets{0.0};    ///< Prefix sums of the leg lengths, size() + 1 entries
+};
+
+}    // namespace dubins
+
+#endif    // DUBINS_ROUTE_HPP
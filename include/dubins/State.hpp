@@ -0,0 +1,17 @@
+#ifndef DUBINS_STATE_HPP
+#define DUBINS_STATE_HPP
+
+#include "dubins/Vector.hpp"
+
+namespace dubins
+{
+/// @brief Object representing state on path
+struct State
+{
+    Vector2D position;    ///< Position
+    double   heading;     ///< Heading
+};
+
+}    // namespace dubins
+
+#endif    // DUBINS_STATE_HPP
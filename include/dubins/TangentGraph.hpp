@@ -0,0 +1,100 @@
+#ifndef DUBINS_TANGENT_GRAPH_HPP
+#define DUBINS_TANGENT_GRAPH_HPP
+
+#include "dubins/Bounds.hpp"
+#include "dubins/Circle.hpp"
+#include "dubins/Primitive.hpp"
+#include "dubins/State.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace dubins
+{
+/// @brief Curvature bounded path found in a tangent graph
+struct TangentPath
+{
+    std::vector<Primitive> primitives;                                       ///< Arcs and lines in order of travel
+    double                 length{std::numeric_limits<double>::infinity()};    ///< Total length
+};
+
+/// @brief Tangent visibility graph around circular obstacles.
+///
+/// Obstacles are inflated by a clearance and travelled around on circles of at least the turning radius, in either
+/// direction. The graph holds the directed tangent from every travel circle to every other one, as computed by
+/// calculate_transfer_line(), each marked blocked if it passes through another inflated obstacle. Queries add the
+/// turning circles of the start and goal and run Dijkstra over tangents, paying for the arc between consecutive
+/// tangents on each circle. Travel circles are assumed not to overlap one another.
+///
+/// Tangents are built in parallel and checked only against the obstacles whose bounding box overlaps theirs. Moving an
+/// obstacle rebuilds the tangents of its own circles and rechecks only the tangents near its old and new position.
+class TangentGraph
+{
+    public:
+    /// @brief Graph settings
+    struct Options
+    {
+        double      turning_radius{1.0};    ///< Turning radius, travel circles are at least this large
+        double      clearance{0.0};         ///< Added to the obstacle radii
+        std::size_t threads{1};             ///< Worker threads, 0 for one per hardware thread
+    };
+
+    /// @brief Create an empty graph
+    TangentGraph() = default;
+
+    /// @brief Build the graph
+    /// @param obstacles circular obstacles
+    /// @param options graph settings
+    TangentGraph(std::vector<Circle> obstacles, const Options& options);
+
+    /// @brief Move or resize an obstacle, updating only the affected tangents
+    /// @param obstacle index of the obstacle
+    /// @param circle new obstacle
+    void move(std::size_t obstacle, const Circle& circle);
+
+    /// @brief Find the shortest path between two states
+    /// @param start State of the path start
+    /// @param goal State at the path end
+    /// @return path, or empty if every tangent route is blocked
+    std::optional<TangentPath> plan(const State& start, const State& goal) const;
+
+    /// @brief Get the obstacles, without inflation
+    /// @return obstacles
+    const std::vector<Circle>& obstacles() const noexcept;
+
+    /// @brief Get the number of unblocked tangents between obstacles
+    /// @return number of tangents
+    std::size_t edge_count() const noexcept;
+
+    /// @brief Get the options the graph was built with
+    /// @return options
+    const Options& options() const noexcept;
+
+    private:
+    // Directed tangent between two travel circles
+    struct Edge
+    {
+        std::uint32_t to{0};             ///< Circle the tangent arrives at
+        Line2D        line;              ///< Tangent line
+        double        depart{0.0};       ///< Angle of the tangent start on the source circle
+        double        arrive{0.0};       ///< Angle of the tangent end on the target circle
+        bool          exists{false};     ///< The circles have a tangent, overlapping circles may not
+        bool          blocked{false};    ///< Passes through an inflated obstacle, or does not exist
+    };
+
+    Circle travel_circle(std::size_t node) const noexcept;
+    void   connect(std::size_t node);
+    bool   blocked(const Line2D& line, std::size_t skip_a, std::size_t skip_b) const;
+
+    Options                        m_options;
+    std::vector<Circle>            m_obstacles;
+    BoundingBoxes                  m_boxes;    ///< Bounding box of every inflated obstacle
+    std::vector<std::vector<Edge>> m_edges;    ///< Tangents leaving each circle, circle 2i is CCW around obstacle i
+};
+
+}    // namespace dubins
+
+#endif    // DUBINS_TANGENT_GRAPH_HPP
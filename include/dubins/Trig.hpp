@@ -0,0 +1,143 @@
+#ifndef DUBINS_TRIG_HPP
+#define DUBINS_TRIG_HPP
+
+#include "dubins/Angle.hpp"
+#include "dubins/Vector.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+namespace dubins
+{
+/// @brief Selects how the library evaluates atan2 and sin/cos internally
+enum class TrigMode : std::uint8_t
+{
+    exact,         ///< Use the standard library
+    approximate    ///< Use the bounded error polynomials below
+};
+
+/// @brief Maximum absolute error of approx_atan2 in radians
+constexpr double approx_atan2_max_error = 1.0e-10;
+
+/// @brief Maximum absolute error of approx_sincos for |angle| < 1e6
+constexpr double approx_sincos_max_error = 1.0e-13;
+
+/// @brief Set the trig mode used by the library. The default is TrigMode::exact, unless the library was built with
+/// DUBINS_FAST_TRIG defined.
+/// @param mode mode to use
+void set_trig_mode(TrigMode mode) noexcept;
+
+/// @brief Get the trig mode used by the library
+/// @return current mode
+TrigMode trig_mode() noexcept;
+
+/// @brief Branch-free polynomial atan2.
+///
+/// The argument is folded into the first octant and then shifted by pi/4 so the series argument satisfies
+/// |u| <= tan(pi/8). The alternating Taylor series truncated after u^21 then has an error below u^23/23 < 7e-11.
+/// @param y y coordinate
+/// @param x x coordinate
+/// @return angle in [-pi, pi], sign conventions for zeros match std::atan2
+inline double approx_atan2(double y, double x) noexcept
+{
+    constexpr double tan_pi_8 = 0.41421356237309503;
+
+    const double ax = std::abs(x);
+    const double ay = std::abs(y);
+    const double mx = ax > ay ? ax : ay;
+    const double mn = ax > ay ? ay : ax;
+    const double t  = mx == 0.0 ? 0.0 : mn / mx;
+
+    const bool   shift = t > tan_pi_8;
+    const double u     = shift ? (t - 1.0) / (t + 1.0) : t;
+    const double u2    = u * u;
+
+    double p = 1.0 / 21.0;
+    p        = p * u2 - 1.0 / 19.0;
+    p        = p * u2 + 1.0 / 17.0;
+    p        = p * u2 - 1.0 / 15.0;
+    p        = p * u2 + 1.0 / 13.0;
+    p        = p * u2 - 1.0 / 11.0;
+    p        = p * u2 + 1.0 / 9.0;
+    p        = p * u2 - 1.0 / 7.0;
+    p        = p * u2 + 1.0 / 5.0;
+    p        = p * u2 - 1.0 / 3.0;
+
+    double a = u + u * u2 * p + (shift ? M_PI_4 : 0.0);
+    a        = ay > ax ? M_PI_2 - a : a;
+    a        = std::copysign(1.0, x) < 0.0 ? M_PI - a : a;    // signbit(x), in a form that vectorizes
+    return std::copysign(a, y);
+}
+
+/// @brief Branch-free polynomial sin and cos.
+///
+/// The argument is reduced to r in [-pi/4, pi/4] with a two part pi/2, then the Taylor series of sin and cos are
+/// truncated after r^13 and r^14, which bounds the error by (pi/4)^15/15! < 3e-14.
+/// @param angle argument
+/// @param s sine of the argument
+/// @param c cosine of the argument
+inline void approx_sincos(double angle, double& s, double& c) noexcept
+{
+    constexpr double two_over_pi = 2.0 / M_PI;
+    constexpr double pi_2_hi     = 0x1.921fb5p+0;             // pi/2 with the low 27 bits cleared
+    constexpr double pi_2_lo     = 1.5893254773528196e-08;    // pi/2 - pi_2_hi
+
+    const double k = detail::round_nearest(angle * two_over_pi);
+    const double r = (angle - k * pi_2_hi) - k * pi_2_lo;
+
+    const double r2 = r * r;
+
+    double sp = 1.0 / 6227020800.0;    // 1/13!
+    sp        = sp * r2 - 1.0 / 39916800.0;
+    sp        = sp * r2 + 1.0 / 362880.0;
+    sp        = sp * r2 - 1.0 / 5040.0;
+    sp        = sp * r2 + 1.0 / 120.0;
+    sp        = sp * r2 - 1.0 / 6.0;
+    const double sr = r + r * r2 * sp;
+
+    double cp = 1.0 / 87178291200.0;    // 1/14!
+    cp        = cp * r2 - 1.0 / 479001600.0;
+    cp        = cp * r2 + 1.0 / 3628800.0;
+    cp        = cp * r2 - 1.0 / 40320.0;
+    cp        = cp * r2 + 1.0 / 720.0;
+    cp        = cp * r2 - 1.0 / 24.0;
+    cp        = cp * r2 + 0.5;
+    const double cr = 1.0 - r2 * cp;
+
+    // Quadrant selection on k mod 4, kept in floating point: converting to a 64-bit integer only vectorizes with
+    // AVX-512. Non-finite input leaves r as NaN, so the quadrant does not matter there.
+    const double kq   = k - 4.0 * detail::floor(0.25 * k);
+    const double q    = std::abs(k) < 0x1p51 ? kq : 0.0;
+    const bool   swap = std::abs(q - 2.0) == 1.0;    // q is 1 or 3
+    const double so   = swap ? cr : sr;
+    const double co   = swap ? sr : cr;
+
+    s = q >= 2.0 ? -so : so;
+    c = std::abs(q - 1.5) == 0.5 ? -co : co;    // q is 1 or 2
+}
+
+/// @brief Get the angle of a vector, right-handed from the x axis.
+/// @param v vector
+/// @return angle in [-pi, pi]
+inline double angle_of(const Vector2D& v) noexcept
+{
+    return trig_mode() == TrigMode::approximate ? approx_atan2(v.y, v.x) : std::atan2(v.y, v.x);
+}
+
+/// @brief Get the unit vector at an angle, right-handed from the x axis.
+/// @param angle angle
+/// @return unit vector {cos(angle), sin(angle)}
+inline Vector2D unit_vector(double angle) noexcept
+{
+    if (trig_mode() == TrigMode::approximate)
+    {
+        Vector2D u;
+        approx_sincos(angle, u.y, u.x);
+        return u;
+    }
+    return {std::cos(angle), std::sin(angle)};
+}
+
+}    // namespace dubins
+
+#endif    // DUBINS_TRIG_HPP
@@ -1,4 +1,21 @@
+#include "dubins/Anytime.hpp"
+#include "dubins/Bounds.hpp"
+#include "dubins/CostField.hpp"
+#include "dubins/DistanceMatrix.hpp"
 #include "dubins/Dubins.hpp"
+#include "dubins/DynamicDistanceMatrix.hpp"
+#include "dubins/FreeHeading.hpp"
+#include "dubins/Gradient.hpp"
+#include "dubins/HybridAStar.hpp"
+#include "dubins/MotionPrimitives.hpp"
+#include "dubins/OneToMany.hpp"
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Primitive.hpp"
+#include "dubins/Raster.hpp"
+#include "dubins/Replanner.hpp"
+#include "dubins/Roadmap.hpp"
+#include "dubins/Route.hpp"
+#include "dubins/TangentGraph.hpp"
 #include "dubins/Vector.hpp"
 
 #include <pybind11/pybind11.h>
@@ -43,11 +60,353 @@ PYBIND11_MODULE(dubins_python, m)
     py::class_<Dubins>(m, "Dubins")
         .def(py::init<State, State, Dubins::Options>())
         .def("length", &Dubins::length)
-        .def("segmented_path", &Dubins::segmented_path)
-        .def("segmented_rsr", &Dubins::segmented_rsr)
-        .def("segmented_lsl", &Dubins::segmented_lsl)
-        .def("segmented_rsl", &Dubins::segmented_rsl)
-        .def("segmented_lsr", &Dubins::segmented_lsr)
-        .def("segmented_lrl", &Dubins::segmented_lrl)
-        .def("segmented_rlr", &Dubins::segmented_rlr);
+        .def("segmented_path", py::overload_cast<const Dubins::Options&>(&Dubins::segmented_path))
+        .def("segmented_rsr", py::overload_cast<const Dubins::Options&>(&Dubins::segmented_rsr))
+        .def("segmented_lsl", py::overload_cast<const Dubins::Options&>(&Dubins::segmented_lsl))
+        .def("segmented_rsl", py::overload_cast<const Dubins::Options&>(&Dubins::segmented_rsl))
+        .def("segmented_lsr", py::overload_cast<const Dubins::Options&>(&Dubins::segmented_lsr))
+        .def("segmented_lrl", py::overload_cast<const Dubins::Options&>(&Dubins::segmented_lrl))
+        .def("segmented_rlr", py::overload_cast<const Dubins::Options&>(&Dubins::segmented_rlr))
+        .def("adaptive_path", py::overload_cast<double>(&Dubins::adaptive_path, py::const_))
+        .def("primitives", &Dubins::primitives)
+        .def("descriptor", &Dubins::descriptor);
+
+    py::enum_<Word>(m, "Word")
+        .value("LSL", Word::LSL)
+        .value("RSR", Word::RSR)
+        .value("RSL", Word::RSL)
+        .value("LSR", Word::LSR)
+        .value("LRL", Word::LRL)
+        .value("RLR", Word::RLR);
+
+    py::enum_<SegmentType>(m, "SegmentType")
+        .value("left", SegmentType::left)
+        .value("straight", SegmentType::straight)
+        .value("right", SegmentType::right);
+
+    py::class_<Line2D>(m, "Line2D")
+        .def(py::init<>())
+        .def_readwrite("a", &Line2D::a)
+        .def_readwrite("b", &Line2D::b);
+
+    py::class_<ArcPrimitive>(m, "ArcPrimitive")
+        .def(py::init<>())
+        .def_readwrite("center", &ArcPrimitive::center)
+        .def_readwrite("radius", &ArcPrimitive::radius)
+        .def_readwrite("start_angle", &ArcPrimitive::start_angle)
+        .def_readwrite("end_angle", &ArcPrimitive::end_angle)
+        .def_readwrite("sweep", &ArcPrimitive::sweep)
+        .def_readwrite("direction", &ArcPrimitive::direction);
+
+    py::class_<PathDescriptor>(m, "PathDescriptor")
+        .def(py::init<>())
+        .def_readwrite("start", &PathDescriptor::start)
+        .def_readwrite("radius", &PathDescriptor::radius)
+        .def_readwrite("segments", &PathDescriptor::segments)
+        .def_readwrite("word", &PathDescriptor::word)
+        .def("length", [](const PathDescriptor& path) { return length(path); })
+        .def("state_at", [](const PathDescriptor& path, double distance) { return state_at(path, distance); })
+        .def("end_state", [](const PathDescriptor& path) { return end_state(path); });
+
+    m.def("shortest_path", py::overload_cast<const State&, const State&, double>(&shortest_path));
+    m.def("segmented_path", py::overload_cast<const PathDescriptor&, const Dubins::Options&>(&segmented_path));
+    m.def("adaptive_path", py::overload_cast<const PathDescriptor&, double>(&adaptive_path));
+    m.def("primitives", py::overload_cast<const PathDescriptor&>(&primitives));
+
+    py::class_<BoundingBox>(m, "BoundingBox")
+        .def(py::init<>())
+        .def_readwrite("min", &BoundingBox::min)
+        .def_readwrite("max", &BoundingBox::max);
+
+    m.def("bounds", py::overload_cast<const PathDescriptor&>(&bounds));
+
+    py::class_<Grid>(m, "Grid")
+        .def(py::init<>())
+        .def_readwrite("origin", &Grid::origin)
+        .def_readwrite("resolution", &Grid::resolution)
+        .def_readwrite("width", &Grid::width)
+        .def_readwrite("height", &Grid::height);
+
+    py::class_<Cell>(m, "Cell")
+        .def(py::init<>())
+        .def_readwrite("x", &Cell::x)
+        .def_readwrite("y", &Cell::y);
+
+    m.def("rasterize", &rasterize);
+
+    py::class_<CostField::Options>(m, "CostFieldOptions")
+        .def(py::init<>())
+        .def_readwrite("origin", &CostField::Options::origin)
+        .def_readwrite("resolution", &CostField::Options::resolution)
+        .def_readwrite("width", &CostField::Options::width)
+        .def_readwrite("height", &CostField::Options::height)
+        .def_readwrite("headings", &CostField::Options::headings)
+        .def_readwrite("turning_radius", &CostField::Options::turning_radius)
+        .def_readwrite("threads", &CostField::Options::threads);
+
+    py::class_<CostField>(m, "CostField")
+        .def(py::init<>())
+        .def(py::init<State, CostField::Options>())
+        .def_static("load", &CostField::load)
+        .def("save", &CostField::save)
+        .def("lookup", &CostField::lookup)
+        .def("at", &CostField::at)
+        .def("goal", &CostField::goal)
+        .def("quantization_error", &CostField::quantization_error);
+
+    py::class_<MotionPrimitive>(m, "MotionPrimitive")
+        .def_readonly("start_heading", &MotionPrimitive::start_heading)
+        .def_readonly("dx", &MotionPrimitive::dx)
+        .def_readonly("dy", &MotionPrimitive::dy)
+        .def_readonly("end_heading", &MotionPrimitive::end_heading)
+        .def_readonly("length", &MotionPrimitive::length)
+        .def_readonly("word", &MotionPrimitive::word)
+        .def_readonly("bounds", &MotionPrimitive::bounds);
+
+    py::class_<MotionPrimitiveTable::Options>(m, "MotionPrimitiveOptions")
+        .def(py::init<>())
+        .def_readwrite("resolution", &MotionPrimitiveTable::Options::resolution)
+        .def_readwrite("range", &MotionPrimitiveTable::Options::range)
+        .def_readwrite("headings", &MotionPrimitiveTable::Options::headings)
+        .def_readwrite("turning_radius", &MotionPrimitiveTable::Options::turning_radius)
+        .def_readwrite("max_length", &MotionPrimitiveTable::Options::max_length)
+        .def_readwrite("swept_cells", &MotionPrimitiveTable::Options::swept_cells)
+        .def_readwrite("threads", &MotionPrimitiveTable::Options::threads);
+
+    py::class_<MotionPrimitiveTable>(m, "MotionPrimitiveTable")
+        .def(py::init<MotionPrimitiveTable::Options>())
+        .def("primitives", &MotionPrimitiveTable::primitives)
+        .def("path", &MotionPrimitiveTable::path)
+        .def("cells", [](const MotionPrimitiveTable& table, const MotionPrimitive& primitive) {
+            const auto [first, last] = table.cells(primitive);
+            return std::vector<Cell>(first, last);
+        })
+        .def("solved_count", &MotionPrimitiveTable::solved_count);
+    m.def("one_to_many", [](const State& start, const std::vector<State>& goals, double radius) {
+        std::vector<PathDescriptor> paths;
+        one_to_many(start, goals, radius, paths);
+        return paths;
+    });
+    m.def("many_to_one", [](const std::vector<State>& starts, const State& goal, double radius) {
+        std::vector<PathDescriptor> paths;
+        many_to_one(starts, goal, radius, paths);
+        return paths;
+    });
+
+    py::enum_<DistanceMatrix::Precision>(m, "DistanceMatrixPrecision")
+        .value("float16", DistanceMatrix::Precision::float16)
+        .value("float32", DistanceMatrix::Precision::float32);
+    py::class_<DistanceMatrix::Options>(m, "DistanceMatrixOptions")
+        .def(py::init<>())
+        .def_readwrite("tile", &DistanceMatrix::Options::tile)
+        .def_readwrite("precision", &DistanceMatrix::Options::precision)
+        .def_readwrite("threads", &DistanceMatrix::Options::threads);
+
+    py::class_<DistanceMatrix>(m, "DistanceMatrix")
+        .def(py::init<>())
+        .def_static("compute", &DistanceMatrix::compute)
+        .def_static("load", &DistanceMatrix::load)
+        .def("at", &DistanceMatrix::at)
+        .def("size", &DistanceMatrix::size)
+        .def("radius", &DistanceMatrix::radius)
+        .def("empty", &DistanceMatrix::empty);
+
+    py::class_<DynamicDistanceMatrix>(m, "DynamicDistanceMatrix")
+        .def(py::init<double, std::size_t>(), py::arg("radius") = 1.0, py::arg("threads") = 1)
+        .def("insert", &DynamicDistanceMatrix::insert)
+        .def("erase", &DynamicDistanceMatrix::erase)
+        .def("update", &DynamicDistanceMatrix::update)
+        .def("compact", &DynamicDistanceMatrix::compact)
+        .def("at", &DynamicDistanceMatrix::at)
+        .def("state", &DynamicDistanceMatrix::state)
+        .def("contains", &DynamicDistanceMatrix::contains)
+        .def("ids", &DynamicDistanceMatrix::ids)
+        .def("size", &DynamicDistanceMatrix::size)
+        .def("slots", &DynamicDistanceMatrix::slots);
+
+    py::class_<NearestNeighbours>(m, "NearestNeighbours")
+        .def_readonly("k", &NearestNeighbours::k)
+        .def_readonly("index", &NearestNeighbours::index)
+        .def_readonly("length", &NearestNeighbours::length);
+    m.def("nearest_neighbours", &nearest_neighbours, py::arg("states"), py::arg("radius"), py::arg("k"),
+          py::arg("threads") = 1);
+
+    py::class_<Circle>(m, "Circle")
+        .def(py::init<>())
+        .def(py::init<Vector2D, double>())
+        .def_readwrite("center", &Circle::center)
+        .def_readwrite("radius", &Circle::radius);
+    m.def("collides", &collides);
+
+    py::class_<RoadmapEdge>(m, "RoadmapEdge")
+        .def_readonly("to", &RoadmapEdge::to)
+        .def_readonly("segments", &RoadmapEdge::segments)
+        .def_readonly("word", &RoadmapEdge::word)
+        .def("length", &RoadmapEdge::length);
+    py::class_<RoadmapPath>(m, "RoadmapPath")
+        .def_readonly("nodes", &RoadmapPath::nodes)
+        .def_readonly("length", &RoadmapPath::length);
+    py::class_<Roadmap::Options>(m, "RoadmapOptions")
+        .def(py::init<>())
+        .def_readwrite("region", &Roadmap::Options::region)
+        .def_readwrite("nodes", &Roadmap::Options::nodes)
+        .def_readwrite("neighbours", &Roadmap::Options::neighbours)
+        .def_readwrite("turning_radius", &Roadmap::Options::turning_radius)
+        .def_readwrite("max_length", &Roadmap::Options::max_length)
+        .def_readwrite("seed", &Roadmap::Options::seed)
+        .def_readwrite("threads", &Roadmap::Options::threads);
+    py::class_<Roadmap>(m, "Roadmap")
+        .def(py::init<Roadmap::Options, std::vector<Circle>>(), py::arg("options"),
+             py::arg("obstacles") = std::vector<Circle>{})
+        .def(py::init<std::vector<State>, Roadmap::Options, std::vector<Circle>>(), py::arg("nodes"),
+             py::arg("options"), py::arg("obstacles") = std::vector<Circle>{})
+        .def("query", &Roadmap::query)
+        .def("paths", &Roadmap::paths)
+        .def("path", &Roadmap::path)
+        .def("edges", [](const Roadmap& roadmap, std::uint32_t node) {
+            const auto [first, last] = roadmap.edges(node);
+            return std::vector<RoadmapEdge>(first, last);
+        })
+        .def("node", &Roadmap::node)
+        .def("size", &Roadmap::size)
+        .def("edge_count", &Roadmap::edge_count);
+
+    py::class_<HybridAStarPlan>(m, "HybridAStarPlan")
+        .def_readonly("segments", &HybridAStarPlan::segments)
+        .def_readonly("length", &HybridAStarPlan::length);
+    py::class_<HybridAStarStatistics>(m, "HybridAStarStatistics")
+        .def_readonly("expansions", &HybridAStarStatistics::expansions)
+        .def_readonly("shots", &HybridAStarStatistics::shots)
+        .def_readonly("rejected_early", &HybridAStarStatistics::rejected_early)
+        .def_readonly("accepted_broad", &HybridAStarStatistics::accepted_broad)
+        .def_readonly("traversals", &HybridAStarStatistics::traversals)
+        .def_readonly("cached", &HybridAStarStatistics::cached);
+    py::class_<HybridAStar::Options>(m, "HybridAStarOptions")
+        .def(py::init<>())
+        .def_readwrite("turning_radius", &HybridAStar::Options::turning_radius)
+        .def_readwrite("headings", &HybridAStar::Options::headings)
+        .def_readwrite("step", &HybridAStar::Options::step)
+        .def_readwrite("shot_interval", &HybridAStar::Options::shot_interval)
+        .def_readwrite("shot_distance", &HybridAStar::Options::shot_distance)
+        .def_readwrite("max_expansions", &HybridAStar::Options::max_expansions);
+    py::class_<HybridAStar>(m, "HybridAStar")
+        .def(py::init<Grid, std::vector<std::uint8_t>, HybridAStar::Options>())
+        .def("plan", &HybridAStar::plan)
+        .def("statistics", &HybridAStar::statistics)
+        .def("free", &HybridAStar::free);
+
+    py::class_<TangentPath>(m, "TangentPath")
+        .def_readonly("primitives", &TangentPath::primitives)
+        .def_readonly("length", &TangentPath::length);
+    py::class_<TangentGraph::Options>(m, "TangentGraphOptions")
+        .def(py::init<>())
+        .def_readwrite("turning_radius", &TangentGraph::Options::turning_radius)
+        .def_readwrite("clearance", &TangentGraph::Options::clearance)
+        .def_readwrite("threads", &TangentGraph::Options::threads);
+    py::class_<TangentGraph>(m, "TangentGraph")
+        .def(py::init<std::vector<Circle>, TangentGraph::Options>())
+        .def("move", &TangentGraph::move)
+        .def("plan", &TangentGraph::plan)
+        .def("obstacles", &TangentGraph::obstacles)
+        .def("edge_count", &TangentGraph::edge_count);
+
+    m.attr("COMPLETION_BOUND")   = completion::bound;
+    m.attr("COMPLETION_LENGTH")  = completion::length;
+    m.attr("COMPLETION_SAMPLES") = completion::samples;
+    m.def("length_lower_bound", &length_lower_bound, py::arg("start"), py::arg("end"), py::arg("radius"));
+    py::class_<AnytimeBatch::Options>(m, "AnytimeBatchOptions")
+        .def(py::init<>())
+        .def_readwrite("chunk", &AnytimeBatch::Options::chunk)
+        .def_readwrite("sample", &AnytimeBatch::Options::sample)
+        .def_readwrite("sampling", &AnytimeBatch::Options::sampling);
+    py::class_<AnytimeBatch>(m, "AnytimeBatch")
+        .def(py::init<std::vector<State>, std::vector<State>, double, const std::vector<double>&,
+                      const AnytimeBatch::Options&>(),
+             py::arg("starts"), py::arg("ends"), py::arg("radius"), py::arg("priorities") = std::vector<double>{},
+             py::arg("options") = AnytimeBatch::Options{})
+        .def("run", [](AnytimeBatch& batch) { return batch.run(); })
+        .def("run_for",
+             [](AnytimeBatch& batch, double seconds) {
+                 return batch.run_for(std::chrono::duration_cast<AnytimeBatch::Clock::duration>(
+                     std::chrono::duration<double>(seconds)));
+             },
+             py::arg("seconds"))
+        .def("done", &AnytimeBatch::done)
+        .def("size", &AnytimeBatch::size)
+        .def("completed", &AnytimeBatch::completed)
+        .def("lower_bounds", &AnytimeBatch::lower_bounds)
+        .def("paths", &AnytimeBatch::paths)
+        .def("samples", &AnytimeBatch::samples);
+
+    py::class_<FreeHeadingPath>(m, "FreeHeadingPath")
+        .def(py::init<>())
+        .def_readwrite("path", &FreeHeadingPath::path)
+        .def_readwrite("heading", &FreeHeadingPath::heading);
+    m.def("shortest_path_to_point", &shortest_path_to_point);
+    m.def("shortest_path_to_interval", &shortest_path_to_interval);
+
+    py::class_<PathGradient>(m, "PathGradient")
+        .def_readonly("path", &PathGradient::path)
+        .def_readonly("segments", &PathGradient::segments)
+        .def_readonly("length", &PathGradient::length)
+        .def_readonly("near_switch", &PathGradient::near_switch);
+    py::class_<PoseGradient>(m, "PoseGradient")
+        .def_readonly("state", &PoseGradient::state)
+        .def_readonly("x", &PoseGradient::x)
+        .def_readonly("y", &PoseGradient::y)
+        .def_readonly("heading", &PoseGradient::heading);
+    m.def("path_gradient", py::overload_cast<const PathDescriptor&, double>(&path_gradient), py::arg("path"),
+          py::arg("tolerance") = 1e-6);
+    m.def("path_gradient", py::overload_cast<const State&, const State&, double, double>(&path_gradient),
+          py::arg("start"), py::arg("end"), py::arg("radius"), py::arg("tolerance") = 1e-6);
+    m.def(
+        "path_gradients",
+        [](const std::vector<State>& starts, const std::vector<State>& ends, double radius, double tolerance) {
+            std::vector<PathGradient> out;
+            path_gradients(starts, ends, radius, out, tolerance);
+            return out;
+        },
+        py::arg("starts"), py::arg("ends"), py::arg("radius"), py::arg("tolerance") = 1e-6);
+    m.def("pose_gradient", &pose_gradient);
+    m.def("pose_gradients", [](const PathGradient& path, const std::vector<double>& distances) {
+        std::vector<PoseGradient> out;
+        pose_gradients(path, distances, out);
+        return out;
+    });
+
+    m.def("encode", [](const PathDescriptor& path) {
+        const auto data = encode(path);
+        return py::bytes(reinterpret_cast<const char*>(data.data()), data.size());
+    });
+    m.def("decode", [](const py::bytes& bytes) {
+        const auto data = std::string(bytes);
+        if (data.size() != encoded_descriptor_size)
+        {
+            throw py::value_error("expected " + std::to_string(encoded_descriptor_size) + " bytes");
+        }
+        return decode(reinterpret_cast<const std::uint8_t*>(data.data()));
+    });
+
+    py::class_<DubinsRoute>(m, "DubinsRoute")
+        .def(py::init<>())
+        .def(py::init<std::vector<State>, Dubins::Options>())
+        .def("rebuild", &DubinsRoute::rebuild)
+        .def("length", &DubinsRoute::length)
+        .def("size", &DubinsRoute::size)
+        .def("leg", &DubinsRoute::leg)
+        .def("leg_offset", &DubinsRoute::leg_offset)
+        .def("leg_index", &DubinsRoute::leg_index)
+        .def("state_at", &DubinsRoute::state_at)
+        .def("segmented_path", py::overload_cast<const Dubins::Options&>(&DubinsRoute::segmented_path, py::const_))
+        .def("adaptive_path", &DubinsRoute::adaptive_path);
+
+    py::class_<Replanner>(m, "Replanner")
+        .def(py::init<State, State, double>())
+        .def("update_start", &Replanner::update_start)
+        .def("update_end", &Replanner::update_end)
+        .def("update", &Replanner::update)
+        .def("path", &Replanner::path)
+        .def("length", &Replanner::length)
+        .def("word", &Replanner::word)
+        .def("full_evaluations", &Replanner::full_evaluations);
 }
\ No newline at end of file
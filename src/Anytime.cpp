@@ -0,0 +1,137 @@
+#include "dubins/Anytime.hpp"
+#include "dubins/Vector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace dubins
+{
+namespace
+{
+constexpr std::size_t stage_count = 3;
+
+constexpr std::array<std::uint8_t, stage_count> stage_bits{completion::bound, completion::length, completion::samples};
+
+}    // namespace
+
+double length_lower_bound(const State& start, const State& end, double radius) noexcept
+{
+    // Every arc turns the heading by its length over the radius, and the arcs turn through at least the change of
+    // heading the short way round
+    const auto turn = std::abs(std::remainder(end.heading - start.heading, 2.0 * M_PI));
+    return std::max(norm(end.position - start.position), radius * turn);
+}
+
+AnytimeBatch::AnytimeBatch(std::vector<State> starts, std::vector<State> ends, double radius,
+                           const std::vector<double>& priorities, const Options& options) :
+    m_options{options},
+    m_radius{radius},
+    m_starts{std::move(starts)},
+    m_ends{std::move(ends)}
+{
+    const auto n = std::min(m_starts.size(), m_ends.size());
+    m_starts.resize(n);
+    m_ends.resize(n);
+    m_options.chunk                   = std::max<std::size_t>(m_options.chunk, 1);
+    m_options.sampling.turning_radius = radius;
+
+    m_order.resize(n);
+    std::iota(m_order.begin(), m_order.end(), 0u);
+    if (!priorities.empty())
+    {
+        std::stable_sort(m_order.begin(), m_order.end(), [&](std::uint32_t a, std::uint32_t b) {
+            const auto pa = a < priorities.size() ? priorities[a] : 0.0;
+            const auto pb = b < priorities.size() ? priorities[b] : 0.0;
+            return pa > pb;
+        });
+    }
+
+    m_completed.assign(n, 0);
+    m_lower_bounds.resize(n);
+    m_paths.resize(n);
+    m_samples.resize(n);
+
+    // Nothing to sample, the last stage is already complete
+    if (!m_options.sample)
+    {
+        m_next[2] = n;
+    }
+}
+
+bool AnytimeBatch::run(Clock::time_point deadline, const std::atomic<bool>* cancel)
+{
+    for (std::size_t stage = 0; stage < stage_count; ++stage)
+    {
+        while (m_next[stage] < m_order.size())
+        {
+            if (Clock::now() >= deadline || (cancel != nullptr && cancel->load(std::memory_order_relaxed)))
+            {
+                return false;
+            }
+
+            const auto begin = m_next[stage];
+            const auto end   = std::min(m_order.size(), begin + m_options.chunk);
+            process(stage, begin, end);
+            m_next[stage] = end;
+        }
+    }
+    return true;
+}
+
+bool AnytimeBatch::run_for(Clock::duration budget, const std::atomic<bool>* cancel)
+{
+    return run(Clock::now() + budget, cancel);
+}
+
+void AnytimeBatch::process(std::size_t stage, std::size_t begin, std::size_t end)
+{
+    for (std::size_t k = begin; k < end; ++k)
+    {
+        const auto i = m_order[k];
+        switch (stage)
+        {
+            case 0: m_lower_bounds[i] = length_lower_bound(m_starts[i], m_ends[i], m_radius); break;
+            case 1: m_paths[i] = shortest_path(m_starts[i], m_ends[i], m_radius); break;
+            default: m_samples[i] = segmented_path(m_paths[i], m_options.sampling); break;
+        }
+        m_completed[i] |= stage_bits[stage];
+    }
+}
+
+bool AnytimeBatch::done() const noexcept
+{
+    return std::all_of(m_next.begin(), m_next.end(), [&](std::size_t next) { return next >= m_order.size(); });
+}
+
+std::size_t AnytimeBatch::size() const noexcept
+{
+    return m_order.size();
+}
+
+const std::vector<std::uint8_t>& AnytimeBatch::completed() const noexcept
+{
+    return m_completed;
+}
+
+const std::vector<double>& AnytimeBatch::lower_bounds() const noexcept
+{
+    return m_lower_bounds;
+}
+
+const std::vector<PathDescriptor>& AnytimeBatch::paths() const noexcept
+{
+    return m_paths;
+}
+
+const std::vector<std::vector<State>>& AnytimeBatch::samples() const noexcept
+{
+    return m_samples;
+}
+
+const AnytimeBatch::Options& AnytimeBatch::options() const noexcept
+{
+    return m_options;
+}
+
+}    // namespace dubins
@@ -0,0 +1,130 @@
+#include "dubins/Bounds.hpp"
+#include "dubins/Angle.hpp"
+
+#include "Parallel.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <variant>
+#include <vector>
+
+namespace dubins
+{
+namespace
+{
+Vector2D point_on_circle(const ArcPrimitive& arc, double angle) noexcept
+{
+    return arc.center + arc.radius * Vector2D{std::cos(angle), std::sin(angle)};
+}
+
+}    // namespace
+
+BoundingBox bounds(const Line2D& line) noexcept
+{
+    BoundingBox box;
+    expand(box, line.a);
+    expand(box, line.b);
+    return box;
+}
+
+BoundingBox bounds(const Circle& circle) noexcept
+{
+    const Vector2D extent{circle.radius, circle.radius};
+    return {circle.center - extent, circle.center + extent};
+}
+
+BoundingBox bounds(const ArcPrimitive& arc) noexcept
+{
+    BoundingBox box;
+    expand(box, point_on_circle(arc, arc.start_angle));
+    expand(box, point_on_circle(arc, arc.start_angle + arc.sweep));
+
+    // Circle extremes at +x, +y, -x and -y
+    const std::array<Vector2D, 4> extremes{Vector2D{arc.radius, 0.0}, Vector2D{0.0, arc.radius},
+                                           Vector2D{-arc.radius, 0.0}, Vector2D{0.0, -arc.radius}};
+
+    const Angle start{arc.start_angle};
+    for (std::size_t k = 0; k < extremes.size(); ++k)
+    {
+        const Angle extreme{double(k) * M_PI_2};
+
+        // Angle travelled from the arc start to the extreme in the direction of travel
+        const auto travel = arc.sweep >= 0.0 ? Angle::positive_difference(extreme, start)
+                                             : Angle::positive_difference(start, extreme);
+        if (travel <= std::abs(arc.sweep))
+        {
+            expand(box, arc.center + extremes[k]);
+        }
+    }
+
+    return box;
+}
+
+BoundingBox bounds(const Primitive& primitive) noexcept
+{
+    return std::visit([](const auto& p) { return bounds(p); }, primitive);
+}
+
+BoundingBox bounds(const PathDescriptor& path) noexcept
+{
+    BoundingBox box;
+    for (const auto& primitive : primitives(path))
+    {
+        expand(box, bounds(primitive));
+    }
+    return box;
+}
+
+void bounds(const std::vector<PathDescriptor>& paths, BoundingBoxes& out, std::size_t threads)
+{
+    out.min_x.resize(paths.size());
+    out.min_y.resize(paths.size());
+    out.max_x.resize(paths.size());
+    out.max_y.resize(paths.size());
+
+    detail::parallel_for(paths.size(), threads, [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i)
+        {
+            const auto box = bounds(paths[i]);
+            out.min_x[i]   = box.min.x;
+            out.min_y[i]   = box.min.y;
+            out.max_x[i]   = box.max.x;
+            out.max_y[i]   = box.max.y;
+        }
+    });
+}
+
+void overlapping(const BoundingBoxes& boxes, const BoundingBox& query, std::vector<std::size_t>& out)
+{
+    out.clear();
+
+    const auto* min_x = boxes.min_x.data();
+    const auto* min_y = boxes.min_y.data();
+    const auto* max_x = boxes.max_x.data();
+    const auto* max_y = boxes.max_y.data();
+
+    // Evaluate a block of boxes without branches so the compiler can vectorize the test, then gather the hits
+    constexpr std::size_t block = 64;
+
+    std::array<std::uint8_t, block> hit;
+    for (std::size_t first = 0; first < boxes.size(); first += block)
+    {
+        const auto count = std::min(block, boxes.size() - first);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto j = first + i;
+            hit[i]       = (min_x[j] <= query.max.x) & (query.min.x <= max_x[j]) & (min_y[j] <= query.max.y)
+                     & (query.min.y <= max_y[j]);
+        }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (hit[i])
+            {
+                out.push_back(first + i);
+            }
+        }
+    }
+}
+
+}    // namespace dubins
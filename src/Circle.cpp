@@ -1,13 +1,20 @@
 #include "dubins/Circle.hpp"
 #include "dubins/Vector.hpp"
 
+#include "Dispatch.hpp"
+
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <optional>
 
 namespace dubins
 {
 namespace
 {
+// Allow for rounding when the circles are (nearly) touching, the tangent is then unique.
+constexpr double tangent_tolerance = 1.0e-12;
+
 struct DeconstructedVector
 {
     Vector2D u{1.0, 0.0};
@@ -44,7 +51,7 @@ std::optional<Line2D> calculate_tangent_impl(const Circle& a, const Circle& b, c
 
     const auto c = (a.radius - sign1 * b.radius) / v->magnitude;
 
-    if (c * c > 1.0)
+    if (c * c > 1.0 + tangent_tolerance)
     {
         return std::nullopt;
     }
@@ -85,6 +92,141 @@ std::optional<Circle> calculate_transfer_circle_impl(const Circle& a, const Circ
     return Circle{a.center + dist_ap * v - sign * dist_pc * perpendicular(v), r};
 }
 
+// calculate_tangent_impl() over a batch, with the signs fixed so the loop body has no branches
+template<int Sign1, int Sign2>
+DUBINS_KERNEL void tangent_kernel(const Circles& a, const Circles& b, Lines& out, std::uint8_t* valid) noexcept
+{
+    const auto  n  = out.size();
+    const auto* ax = a.x.data();
+    const auto* ay = a.y.data();
+    const auto* ar = a.radius.data();
+    const auto* bx = b.x.data();
+    const auto* by = b.y.data();
+    const auto* br = b.radius.data();
+    auto*       lx = out.ax.data();
+    auto*       ly = out.ay.data();
+    auto*       mx = out.bx.data();
+    auto*       my = out.by.data();
+
+    DUBINS_NO_ALIAS
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const auto vx      = bx[i] - ax[i];
+        const auto vy      = by[i] - ay[i];
+        const auto dist_sq = vx * vx + vy * vy;
+        const auto rd      = ar[i] - br[i];
+        const auto apart   = dist_sq > rd * rd;
+
+        // Coincident centers must not divide by zero. A select on apart would do, but it stops the loop vectorizing.
+        const auto dist = std::sqrt(std::max(dist_sq, std::numeric_limits<double>::min()));
+        const auto ux   = vx / dist;
+        const auto uy   = vy / dist;
+        const auto c    = (ar[i] - Sign1 * br[i]) / dist;
+        const auto h    = std::sqrt(std::max(0.0, 1.0 - c * c));
+        const auto nx   = ux * c - Sign2 * h * uy;
+        const auto ny   = uy * c + Sign2 * h * ux;
+
+        lx[i]    = ax[i] + ar[i] * nx;
+        ly[i]    = ay[i] + ar[i] * ny;
+        mx[i]    = bx[i] + Sign1 * br[i] * nx;
+        my[i]    = by[i] + Sign1 * br[i] * ny;
+        valid[i] = static_cast<std::uint8_t>(apart & (c * c <= 1.0 + tangent_tolerance));
+    }
+}
+
+// calculate_transfer_circle_impl() over a batch
+template<int Sign>
+DUBINS_KERNEL void transfer_circle_kernel(const Circles& a, const Circles& b, double r, Circles& out,
+                                          std::uint8_t* valid) noexcept
+{
+    const auto  n  = out.size();
+    const auto* ax = a.x.data();
+    const auto* ay = a.y.data();
+    const auto* ar = a.radius.data();
+    const auto* bx = b.x.data();
+    const auto* by = b.y.data();
+    const auto* br = b.radius.data();
+    auto*       cx = out.x.data();
+    auto*       cy = out.y.data();
+    auto*       cr = out.radius.data();
+
+    DUBINS_NO_ALIAS
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const auto vx   = bx[i] - ax[i];
+        const auto vy   = by[i] - ay[i];
+        const auto dist = vx * vx + vy * vy;
+        const auto rd   = ar[i] - br[i];
+
+        const auto radius_ac    = ar[i] + r;
+        const auto radius_bc    = br[i] + r;
+        const auto radius_ac_sq = radius_ac * radius_ac;
+        const auto radius_bc_sq = radius_bc * radius_bc;
+
+        // Neither circle inside the other, and close enough for the transfer circle to touch both
+        const auto ok   = (dist > rd * rd) & (dist <= radius_ac_sq + radius_bc_sq + radius_ac * radius_bc);
+        const auto safe = std::max(dist, std::numeric_limits<double>::min());
+
+        const auto dist_ap = (safe + radius_ac_sq - radius_bc_sq) / (2 * safe);
+        const auto dist_pc = std::sqrt(std::max(0.0, (radius_ac_sq / safe - dist_ap * dist_ap)));
+
+        cx[i]    = ax[i] + dist_ap * vx + Sign * dist_pc * vy;
+        cy[i]    = ay[i] + dist_ap * vy - Sign * dist_pc * vx;
+        cr[i]    = r;
+        valid[i] = static_cast<std::uint8_t>(ok);
+    }
+}
+
+template<int Sign1, int Sign2>
+struct TangentKernel
+{
+    static DUBINS_KERNEL void run(const Circles& a, const Circles& b, Lines& out, std::uint8_t* valid) noexcept
+    {
+        tangent_kernel<Sign1, Sign2>(a, b, out, valid);
+    }
+    static void scalar(const Circles& a, const Circles& b, Lines& out, std::uint8_t* valid) noexcept
+    {
+        for (std::size_t i = 0; i < out.size(); ++i)
+        {
+            const auto line = calculate_tangent_impl({{a.x[i], a.y[i]}, a.radius[i]}, {{b.x[i], b.y[i]}, b.radius[i]},
+                                                     Sign1, Sign2);
+            valid[i]        = static_cast<std::uint8_t>(line.has_value());
+            if (line)
+            {
+                out.ax[i] = line->a.x;
+                out.ay[i] = line->a.y;
+                out.bx[i] = line->b.x;
+                out.by[i] = line->b.y;
+            }
+        }
+    }
+};
+
+template<int Sign>
+struct TransferCircleKernel
+{
+    static DUBINS_KERNEL void run(const Circles& a, const Circles& b, double r, Circles& out,
+                                  std::uint8_t* valid) noexcept
+    {
+        transfer_circle_kernel<Sign>(a, b, r, out, valid);
+    }
+    static void scalar(const Circles& a, const Circles& b, double r, Circles& out, std::uint8_t* valid) noexcept
+    {
+        for (std::size_t i = 0; i < out.size(); ++i)
+        {
+            const auto circle = calculate_transfer_circle_impl({{a.x[i], a.y[i]}, a.radius[i]},
+                                                               {{b.x[i], b.y[i]}, b.radius[i]}, r, Sign);
+            valid[i]          = static_cast<std::uint8_t>(circle.has_value());
+            if (circle)
+            {
+                out.x[i]      = circle->center.x;
+                out.y[i]      = circle->center.y;
+                out.radius[i] = circle->radius;
+            }
+        }
+    }
+};
+
 };    // namespace
 
 std::optional<Line2D> calculate_transfer_line(const CircleCW& a, const CircleCW& b) noexcept
@@ -127,6 +269,55 @@ std::optional<CircleCW> calculate_transfer_circle(const CircleCCW& a, const Circ
     return std::nullopt;
 }
 
+void calculate_transfer_lines(const Circles& a, Rotation a_rotation, const Circles& b, Rotation b_rotation, Lines& out,
+                              std::vector<std::uint8_t>& valid)
+{
+    const auto n = std::min(a.size(), b.size());
+    out.resize(n);
+    valid.resize(n);
+
+    // Same signs as the calculate_transfer_line() overloads
+    if (a_rotation == Rotation::cw)
+    {
+        if (b_rotation == Rotation::cw)
+        {
+            detail::dispatch<TangentKernel<1, 1>>(a, b, out, valid.data());
+        }
+        else
+        {
+            detail::dispatch<TangentKernel<-1, 1>>(a, b, out, valid.data());
+        }
+    }
+    else
+    {
+        if (b_rotation == Rotation::cw)
+        {
+            detail::dispatch<TangentKernel<-1, -1>>(a, b, out, valid.data());
+        }
+        else
+        {
+            detail::dispatch<TangentKernel<1, -1>>(a, b, out, valid.data());
+        }
+    }
+}
+
+void calculate_transfer_circles(const Circles& a, const Circles& b, Rotation rotation, double r, Circles& out,
+                                std::vector<std::uint8_t>& valid)
+{
+    const auto n = std::min(a.size(), b.size());
+    out.resize(n);
+    valid.resize(n);
+
+    if (rotation == Rotation::cw)
+    {
+        detail::dispatch<TransferCircleKernel<1>>(a, b, r, out, valid.data());
+    }
+    else
+    {
+        detail::dispatch<TransferCircleKernel<-1>>(a, b, r, out, valid.data());
+    }
+}
+
 bool inside(const Circle& a, const Circle& b) noexcept
 {
     if (a.radius < b.radius)
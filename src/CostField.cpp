@@ -0,0 +1,239 @@
+#include "dubins/CostField.hpp"
+#include "dubins/Angle.hpp"
+#include "dubins/PathDescriptor.hpp"
+
+#include "MappedFile.hpp"
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+namespace dubins
+{
+namespace
+{
+// File layout: a fixed size header followed by the quantized lengths in native byte order
+constexpr std::size_t   header_size    = 128;
+constexpr char          magic[4]       = {'D', 'B', 'C', 'F'};
+constexpr std::uint16_t byte_order     = 0x0102;    // Reads back as 0x0201 on a host of the other endianness
+constexpr std::uint16_t format_version = 1;
+
+template<typename T>
+void put(std::array<std::uint8_t, header_size>& header, std::size_t offset, const T& value) noexcept
+{
+    std::memcpy(&header[offset], &value, sizeof(T));
+}
+
+template<typename T>
+T get(const std::uint8_t* header, std::size_t offset) noexcept
+{
+    T value;
+    std::memcpy(&value, header + offset, sizeof(T));
+    return value;
+}
+
+}    // namespace
+
+CostField::CostField(const State& goal, const Options& options) : m_goal{goal}, m_options{options}
+{
+    if (options.width <= 0 || options.height <= 0 || options.headings <= 0)
+    {
+        return;
+    }
+
+    const auto r    = options.turning_radius;
+    const auto step = 2.0 * M_PI / double(options.headings);
+
+    // An LSL path always exists and is no longer than the center distance plus two full turns. This bounds every
+    // length in the field without a separate pass to find the maximum.
+    double max_distance = 0.0;
+    for (const auto cx : {0, options.width - 1})
+    {
+        for (const auto cy : {0, options.height - 1})
+        {
+            const Vector2D corner = options.origin + options.resolution * Vector2D{double(cx), double(cy)};
+            max_distance          = std::max(max_distance, norm(corner - goal.position));
+        }
+    }
+    const auto max_length = max_distance + 2.0 * r + 4.0 * M_PI * r;
+    m_scale               = max_length / double(std::numeric_limits<std::uint16_t>::max());
+
+    auto data = std::make_shared<std::vector<std::uint16_t>>(std::size_t(options.width) * std::size_t(options.height)
+                                                             * std::size_t(options.headings));
+
+    const auto to_goal = turning_circles(goal, r);
+
+    // Each row writes a contiguous block of the output
+    detail::parallel_for(std::size_t(options.height), options.threads, [&](std::size_t begin, std::size_t end) {
+        for (auto y = begin; y < end; ++y)
+        {
+            auto* out = data->data() + index(0, std::int32_t(y), 0);
+            for (std::int32_t x = 0; x < options.width; ++x)
+            {
+                const Vector2D position = options.origin + options.resolution * Vector2D{double(x), double(y)};
+                for (std::int32_t k = 0; k < options.headings; ++k)
+                {
+                    const auto len = length(shortest_path(turning_circles({position, step * k}, r), to_goal));
+                    *out++         = static_cast<std::uint16_t>(std::min(std::round(len / m_scale), 65535.0));
+                }
+            }
+        }
+    });
+
+    m_data = std::shared_ptr<const std::uint16_t>(data, data->data());
+}
+
+std::optional<CostField> CostField::load(const std::string& filename)
+{
+    const auto view = detail::map_file(filename);
+    if (view.data == nullptr || view.size < header_size)
+    {
+        return std::nullopt;
+    }
+
+    const auto* header = view.data.get();
+    if (std::memcmp(header, magic, sizeof(magic)) != 0 || get<std::uint16_t>(header, 4) != byte_order
+        || get<std::uint16_t>(header, 6) != format_version)
+    {
+        return std::nullopt;
+    }
+
+    CostField field;
+    field.m_options.width          = get<std::int32_t>(header, 8);
+    field.m_options.height         = get<std::int32_t>(header, 12);
+    field.m_options.headings       = get<std::int32_t>(header, 16);
+    field.m_options.origin.x       = get<double>(header, 24);
+    field.m_options.origin.y       = get<double>(header, 32);
+    field.m_options.resolution     = get<double>(header, 40);
+    field.m_options.turning_radius = get<double>(header, 48);
+    field.m_goal.position.x        = get<double>(header, 56);
+    field.m_goal.position.y        = get<double>(header, 64);
+    field.m_goal.heading           = get<double>(header, 72);
+    field.m_scale                  = get<double>(header, 80);
+
+    const auto& opt = field.m_options;
+    if (opt.width <= 0 || opt.height <= 0 || opt.headings <= 0)
+    {
+        return std::nullopt;
+    }
+
+    const auto count = std::size_t(opt.width) * std::size_t(opt.height) * std::size_t(opt.headings);
+    if (view.size != header_size + count * sizeof(std::uint16_t))
+    {
+        return std::nullopt;
+    }
+
+    // The header size keeps the lengths aligned within the (page aligned) mapping
+    field.m_data = std::shared_ptr<const std::uint16_t>(
+        view.data, reinterpret_cast<const std::uint16_t*>(view.data.get() + header_size));
+
+    return field;
+}
+
+bool CostField::save(const std::string& filename) const
+{
+    if (empty())
+    {
+        return false;
+    }
+
+    std::array<std::uint8_t, header_size> header{};
+    std::memcpy(header.data(), magic, sizeof(magic));
+    put(header, 4, byte_order);
+    put(header, 6, format_version);
+    put(header, 8, m_options.width);
+    put(header, 12, m_options.height);
+    put(header, 16, m_options.headings);
+    put(header, 24, m_options.origin.x);
+    put(header, 32, m_options.origin.y);
+    put(header, 40, m_options.resolution);
+    put(header, 48, m_options.turning_radius);
+    put(header, 56, m_goal.position.x);
+    put(header, 64, m_goal.position.y);
+    put(header, 72, m_goal.heading);
+    put(header, 80, m_scale);
+
+    std::ofstream file{filename, std::ios::binary | std::ios::trunc};
+    const auto    count = std::size_t(m_options.width) * std::size_t(m_options.height)
+                          * std::size_t(m_options.headings);
+
+    file.write(reinterpret_cast<const char*>(header.data()), header.size());
+    file.write(reinterpret_cast<const char*>(m_data.get()), std::streamsize(count * sizeof(std::uint16_t)));
+
+    return file.good();
+}
+
+double CostField::lookup(const State& state) const noexcept
+{
+    if (empty())
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    const auto local = (state.position - m_options.origin) / m_options.resolution;
+    if (!(local.x >= 0.0 && local.y >= 0.0 && local.x <= double(m_options.width - 1)
+          && local.y <= double(m_options.height - 1)))
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    const auto h = (double)Angle{state.heading} * double(m_options.headings) / (2.0 * M_PI);
+
+    const auto x0 = std::min(static_cast<std::int32_t>(local.x), m_options.width - 1);
+    const auto y0 = std::min(static_cast<std::int32_t>(local.y), m_options.height - 1);
+    const auto k0 = std::min(static_cast<std::int32_t>(h), m_options.headings - 1);
+    const auto x1 = std::min(x0 + 1, m_options.width - 1);
+    const auto y1 = std::min(y0 + 1, m_options.height - 1);
+    const auto k1 = (k0 + 1) % m_options.headings;
+
+    const auto fx = local.x - double(x0);
+    const auto fy = local.y - double(y0);
+    const auto fk = h - double(k0);
+
+    const auto* data = m_data.get();
+    const auto  lerp = [](double a, double b, double t) { return a + t * (b - a); };
+    const auto  edge = [&](std::int32_t x, std::int32_t y) {
+        return lerp(double(data[index(x, y, k0)]), double(data[index(x, y, k1)]), fk);
+    };
+
+    const auto value = lerp(lerp(edge(x0, y0), edge(x1, y0), fx), lerp(edge(x0, y1), edge(x1, y1), fx), fy);
+    return value * m_scale;
+}
+
+double CostField::at(std::int32_t x, std::int32_t y, std::int32_t heading) const noexcept
+{
+    return double(m_data.get()[index(x, y, heading)]) * m_scale;
+}
+
+const State& CostField::goal() const noexcept
+{
+    return m_goal;
+}
+
+const CostField::Options& CostField::options() const noexcept
+{
+    return m_options;
+}
+
+double CostField::quantization_error() const noexcept
+{
+    return 0.5 * m_scale;
+}
+
+bool CostField::empty() const noexcept
+{
+    return m_data == nullptr;
+}
+
+std::size_t CostField::index(std::int32_t x, std::int32_t y, std::int32_t heading) const noexcept
+{
+    return (std::size_t(y) * std::size_t(m_options.width) + std::size_t(x)) * std::size_t(m_options.headings)
+           + std::size_t(heading);
+}
+
+}    // namespace dubins
@@ -0,0 +1,83 @@
+#ifndef DUBINS_DISPATCH_HPP
+#define DUBINS_DISPATCH_HPP
+
+#include "dubins/Isa.hpp"
+
+#include <utility>
+
+// Kernels are compiled once per instruction set with target attributes, so the rest of the library keeps the baseline
+// flags and one binary runs everywhere. Only GCC and Clang on x86-64 get the extra variants.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(DUBINS_NO_ISA_DISPATCH)
+#define DUBINS_ISA_DISPATCH 1
+#define DUBINS_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define DUBINS_TARGET_AVX512 __attribute__((target("avx512f,avx512dq,avx512vl,avx512bw,avx2,fma")))
+#else
+#define DUBINS_ISA_DISPATCH 0
+#endif
+
+// The kernels are too large for the inliner's default budget, but the loops only vectorize once they are inlined. A
+// kernel inlined into a target function is compiled for that target.
+#if defined(__GNUC__)
+#define DUBINS_KERNEL inline __attribute__((always_inline))
+#define DUBINS_NO_INLINE __attribute__((noinline))
+#else
+#define DUBINS_KERNEL inline
+#define DUBINS_NO_INLINE
+#endif
+
+// The batch kernels read and write more arrays than the vectorizer will check for overlap at run time. They never
+// overlap, so say so.
+#if defined(__clang__)
+#define DUBINS_NO_ALIAS _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#define DUBINS_NO_ALIAS _Pragma("GCC ivdep")
+#else
+#define DUBINS_NO_ALIAS
+#endif
+
+namespace dubins
+{
+namespace detail
+{
+template<typename Kernel, typename... Args>
+void run_generic(Args&&... args) noexcept
+{
+    Kernel::run(args...);
+}
+
+#if DUBINS_ISA_DISPATCH
+template<typename Kernel, typename... Args>
+DUBINS_TARGET_AVX2 void run_avx2(Args&&... args) noexcept
+{
+    Kernel::run(args...);
+}
+
+template<typename Kernel, typename... Args>
+DUBINS_TARGET_AVX512 void run_avx512(Args&&... args) noexcept
+{
+    Kernel::run(args...);
+}
+#endif
+
+/// @brief Run a kernel with the instruction set selected by isa()
+/// @tparam Kernel type with a static DUBINS_KERNEL run(args...), compiled once per instruction set, and a static
+/// scalar(args...) that computes the same one element at a time
+/// @param args arguments passed on to the kernel
+template<typename Kernel, typename... Args>
+void dispatch(Args&&... args) noexcept
+{
+    switch (isa())
+    {
+        case Isa::scalar: Kernel::scalar(args...); return;
+#if DUBINS_ISA_DISPATCH
+        case Isa::avx2: run_avx2<Kernel>(std::forward<Args>(args)...); return;
+        case Isa::avx512: run_avx512<Kernel>(std::forward<Args>(args)...); return;
+#endif
+        default: run_generic<Kernel>(std::forward<Args>(args)...); return;
+    }
+}
+
+}    // namespace detail
+}    // namespace dubins
+
+#endif    // DUBINS_DISPATCH_HPP
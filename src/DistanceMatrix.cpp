@@ -0,0 +1,523 @@
+#include "dubins/DistanceMatrix.hpp"
+#include "dubins/OneToMany.hpp"
+
+#include "MappedFile.hpp"
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace dubins
+{
+namespace
+{
+// File layout, see DistanceMatrix
+constexpr std::size_t   header_size    = 128;
+constexpr std::size_t   data_alignment = 4096;
+constexpr char          magic[4]       = {'D', 'B', 'D', 'M'};
+constexpr std::uint16_t byte_order     = 0x0102;    // Reads back as 0x0201 on a host of the other endianness
+constexpr std::uint16_t format_version = 1;
+
+template<typename T>
+void put(std::uint8_t* header, std::size_t offset, const T& value) noexcept
+{
+    std::memcpy(header + offset, &value, sizeof(T));
+}
+
+template<typename T>
+T get(const std::uint8_t* header, std::size_t offset) noexcept
+{
+    T value;
+    std::memcpy(&value, header + offset, sizeof(T));
+    return value;
+}
+
+// Round to nearest even, overflow and infinity map to infinity
+std::uint16_t to_half(float value) noexcept
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const auto sign     = static_cast<std::uint16_t>((bits >> 16) & 0x8000u);
+    const auto exponent = static_cast<std::int32_t>((bits >> 23) & 0xffu) - 127 + 15;
+    auto       mantissa = bits & 0x7fffffu;
+
+    if ((bits & 0x7fffffffu) >= 0x7f800000u)
+    {
+        return sign | 0x7c00u | (mantissa != 0 ? 0x200u : 0u);
+    }
+    if (exponent >= 31)
+    {
+        return sign | 0x7c00u;
+    }
+    if (exponent <= 0)
+    {
+        // Subnormal half, the implicit bit becomes explicit
+        if (exponent < -10)
+        {
+            return sign;
+        }
+        mantissa |= 0x800000u;
+
+        const auto    shift     = static_cast<std::uint32_t>(14 - exponent);
+        const auto    remainder = mantissa & ((1u << shift) - 1u);
+        const auto    halfway   = 1u << (shift - 1u);
+        std::uint32_t half      = mantissa >> shift;
+        half += (remainder > halfway || (remainder == halfway && (half & 1u))) ? 1u : 0u;
+        return sign | static_cast<std::uint16_t>(half);
+    }
+
+    // A carry out of the mantissa correctly increments the exponent, up to infinity
+    std::uint32_t half      = (static_cast<std::uint32_t>(exponent) << 10) | (mantissa >> 13);
+    const auto    remainder = mantissa & 0x1fffu;
+    half += (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u))) ? 1u : 0u;
+    return sign | static_cast<std::uint16_t>(half);
+}
+
+float from_half(std::uint16_t half) noexcept
+{
+    const auto sign     = static_cast<std::uint32_t>(half & 0x8000u) << 16;
+    const auto exponent = static_cast<std::uint32_t>(half >> 10) & 0x1fu;
+    const auto mantissa = static_cast<std::uint32_t>(half & 0x3ffu);
+
+    std::uint32_t bits;
+    if (exponent == 0)
+    {
+        const auto value = std::ldexp(float(mantissa), -24);
+        return sign != 0 ? -value : value;
+    }
+    else if (exponent == 31)
+    {
+        bits = sign | 0x7f800000u | (mantissa << 13);
+    }
+    else
+    {
+        bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+    }
+
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+std::size_t entry_size(DistanceMatrix::Precision precision) noexcept
+{
+    return precision == DistanceMatrix::Precision::float16 ? sizeof(std::uint16_t) : sizeof(float);
+}
+
+void store(double length, DistanceMatrix::Precision precision, std::uint8_t* out) noexcept
+{
+    if (precision == DistanceMatrix::Precision::float16)
+    {
+        const auto half = to_half(static_cast<float>(length));
+        std::memcpy(out, &half, sizeof(half));
+    }
+    else
+    {
+        const auto single = static_cast<float>(length);
+        std::memcpy(out, &single, sizeof(single));
+    }
+}
+
+// FNV-1a over the states and radius, identifies the problem a file was computed for
+std::uint64_t fingerprint(const std::vector<State>& states, double radius) noexcept
+{
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    const auto    mix  = [&hash](double value) {
+        std::uint8_t bytes[sizeof(double)];
+        std::memcpy(bytes, &value, sizeof(value));
+        for (const auto byte : bytes)
+        {
+            hash = (hash ^ byte) * 0x100000001b3ull;
+        }
+    };
+
+    mix(radius);
+    for (const auto& state : states)
+    {
+        mix(state.position.x);
+        mix(state.position.y);
+        mix(state.heading);
+    }
+    return hash;
+}
+
+struct Layout
+{
+    std::size_t tiles{0};          // Tiles along a row
+    std::size_t tile_bytes{0};     // Bytes per tile
+    std::size_t data_offset{0};    // Offset of the first tile
+    std::size_t file_size{0};
+};
+
+Layout layout(std::size_t size, std::uint32_t tile, DistanceMatrix::Precision precision) noexcept
+{
+    Layout result;
+    result.tiles       = (size + tile - 1) / tile;
+    result.tile_bytes  = std::size_t(tile) * tile * entry_size(precision);
+    result.data_offset = (header_size + result.tiles * result.tiles + data_alignment - 1) / data_alignment
+                         * data_alignment;
+    result.file_size   = result.data_offset + result.tiles * result.tiles * result.tile_bytes;
+    return result;
+}
+
+// Finished tiles handed from the workers to the writer. Bounded so workers can not run far ahead of the disk.
+class TileQueue
+{
+    public:
+    explicit TileQueue(std::size_t capacity) : m_capacity{capacity} {}
+
+    void push(std::size_t tile, std::vector<std::uint8_t> data)
+    {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_not_full.wait(lock, [this]() { return m_items.size() < m_capacity; });
+        m_items.emplace_back(tile, std::move(data));
+        m_not_empty.notify_one();
+    }
+
+    // Returns false once the queue is closed and drained
+    bool pop(std::pair<std::size_t, std::vector<std::uint8_t>>& item)
+    {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_not_empty.wait(lock, [this]() { return !m_items.empty() || m_closed; });
+        if (m_items.empty())
+        {
+            return false;
+        }
+        item = std::move(m_items.front());
+        m_items.pop_front();
+        m_not_full.notify_one();
+        return true;
+    }
+
+    void close()
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_closed = true;
+        m_not_empty.notify_all();
+    }
+
+    private:
+    std::size_t                                                   m_capacity;
+    bool                                                          m_closed{false};
+    std::deque<std::pair<std::size_t, std::vector<std::uint8_t>>> m_items;
+    std::mutex                                                    m_mutex;
+    std::condition_variable                                       m_not_full;
+    std::condition_variable                                       m_not_empty;
+};
+
+void compute_tile(const std::vector<State>& states, double radius, const DistanceMatrix::Options& options,
+                  std::size_t tiles, std::size_t tile, std::vector<std::uint8_t>& out)
+{
+    const auto n    = states.size();
+    const auto size = entry_size(options.precision);
+    const auto row0 = tile / tiles * options.tile;
+    const auto col0 = tile % tiles * options.tile;
+    const auto row1 = std::min(n, row0 + options.tile);
+    const auto col1 = std::min(n, col0 + options.tile);
+
+    const std::vector<State> goals(states.begin() + std::ptrdiff_t(col0), states.begin() + std::ptrdiff_t(col1));
+    std::vector<double>      lengths;
+
+    out.assign(std::size_t(options.tile) * options.tile * size, 0);
+    for (auto row = row0; row < row1; ++row)
+    {
+        one_to_many(states[row], goals, radius, lengths);
+        for (auto col = col0; col < col1; ++col)
+        {
+            const auto length = row == col ? 0.0 : lengths[col - col0];
+            store(length, options.precision, out.data() + ((row - row0) * options.tile + (col - col0)) * size);
+        }
+    }
+}
+
+}    // namespace
+
+std::optional<DistanceMatrix> DistanceMatrix::compute(const std::vector<State>& states, double radius,
+                                                      const std::string& filename, const Options& options)
+{
+    if (states.empty() || options.tile == 0)
+    {
+        return std::nullopt;
+    }
+
+    const auto shape = layout(states.size(), options.tile, options.precision);
+    const auto hash  = fingerprint(states, radius);
+
+    auto view = detail::map_file_writable(filename, shape.file_size);
+    if (view.data == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    auto* header = view.data.get();
+    auto* flags  = header + header_size;
+
+    // The radius is part of the fingerprint
+    const auto resume = std::memcmp(header, magic, sizeof(magic)) == 0 && get<std::uint16_t>(header, 4) == byte_order
+                        && get<std::uint16_t>(header, 6) == format_version
+                        && get<std::uint8_t>(header, 8) == static_cast<std::uint8_t>(options.precision)
+                        && get<std::uint32_t>(header, 12) == options.tile
+                        && get<std::uint64_t>(header, 16) == states.size() && get<std::uint64_t>(header, 32) == hash;
+
+    if (!resume)
+    {
+        std::memset(header, 0, shape.data_offset);
+        std::memcpy(header, magic, sizeof(magic));
+        put(header, 4, byte_order);
+        put(header, 6, format_version);
+        put(header, 8, static_cast<std::uint8_t>(options.precision));
+        put(header, 12, options.tile);
+        put(header, 16, static_cast<std::uint64_t>(states.size()));
+        put(header, 24, radius);
+        put(header, 32, hash);
+        if (!detail::flush(view, 0, shape.data_offset))
+        {
+            return std::nullopt;
+        }
+    }
+
+    std::vector<std::size_t> pending;
+    for (std::size_t t = 0; t < shape.tiles * shape.tiles; ++t)
+    {
+        if (flags[t] == 0)
+        {
+            pending.push_back(t);
+        }
+    }
+
+    // Workers compute tiles into private buffers, a single writer copies them into the mapping and flushes them. The
+    // flag is only set and flushed after the tile data, so a flagged tile is always complete on disk.
+    const auto workers = std::min(detail::thread_count(options.threads), std::max<std::size_t>(pending.size(), 1));
+
+    TileQueue         queue{2 * workers};
+    std::atomic<bool> ok{true};
+
+    std::thread writer{[&]() {
+        std::pair<std::size_t, std::vector<std::uint8_t>> item;
+        while (queue.pop(item))
+        {
+            const auto offset = shape.data_offset + item.first * shape.tile_bytes;
+            std::memcpy(header + offset, item.second.data(), shape.tile_bytes);
+            if (!detail::flush(view, offset, shape.tile_bytes))
+            {
+                ok = false;
+                continue;
+            }
+
+            flags[item.first] = 1;
+            if (!detail::flush(view, header_size + item.first, 1))
+            {
+                ok = false;
+            }
+        }
+    }};
+
+    // A failing worker must not unwind past the writer, which would destroy it while joinable. Its tiles stay
+    // unflagged, so a later call resumes them.
+    std::atomic<std::size_t> next{0};
+    detail::parallel_for(workers, workers, [&](std::size_t, std::size_t) {
+        try
+        {
+            std::vector<std::uint8_t> buffer;
+            for (auto i = next++; i < pending.size() && ok; i = next++)
+            {
+                compute_tile(states, radius, options, shape.tiles, pending[i], buffer);
+                queue.push(pending[i], std::move(buffer));
+            }
+        }
+        catch (...)
+        {
+            ok = false;
+        }
+    });
+
+    queue.close();
+    writer.join();
+
+    if (!ok)
+    {
+        return std::nullopt;
+    }
+
+    DistanceMatrix matrix;
+    matrix.m_data    = std::shared_ptr<const std::uint8_t>(view.data, view.data.get() + shape.data_offset);
+    matrix.m_size    = states.size();
+    matrix.m_tiles   = shape.tiles;
+    matrix.m_radius  = radius;
+    matrix.m_options = options;
+    return matrix;
+}
+
+std::optional<DistanceMatrix> DistanceMatrix::load(const std::string& filename)
+{
+    const auto view = detail::map_file(filename);
+    if (view.data == nullptr || view.size < header_size)
+    {
+        return std::nullopt;
+    }
+
+    const auto* header = view.data.get();
+    if (std::memcmp(header, magic, sizeof(magic)) != 0 || get<std::uint16_t>(header, 4) != byte_order
+        || get<std::uint16_t>(header, 6) != format_version)
+    {
+        return std::nullopt;
+    }
+
+    const auto precision = get<std::uint8_t>(header, 8);
+    if (precision > static_cast<std::uint8_t>(Precision::float32))
+    {
+        return std::nullopt;
+    }
+
+    DistanceMatrix matrix;
+    matrix.m_options.precision = static_cast<Precision>(precision);
+    matrix.m_options.tile      = get<std::uint32_t>(header, 12);
+    matrix.m_size              = static_cast<std::size_t>(get<std::uint64_t>(header, 16));
+    matrix.m_radius            = get<double>(header, 24);
+
+    if (matrix.m_size == 0 || matrix.m_options.tile == 0)
+    {
+        return std::nullopt;
+    }
+
+    const auto shape = layout(matrix.m_size, matrix.m_options.tile, matrix.m_options.precision);
+    if (view.size != shape.file_size)
+    {
+        return std::nullopt;
+    }
+
+    const auto* flags = header + header_size;
+    if (std::any_of(flags, flags + shape.tiles * shape.tiles, [](std::uint8_t flag) { return flag == 0; }))
+    {
+        return std::nullopt;
+    }
+
+    matrix.m_data  = std::shared_ptr<const std::uint8_t>(view.data, header + shape.data_offset);
+    matrix.m_tiles = shape.tiles;
+    return matrix;
+}
+
+double DistanceMatrix::at(std::size_t from, std::size_t to) const noexcept
+{
+    const std::size_t tile  = m_options.tile;
+    const auto        index = (from / tile * m_tiles + to / tile) * tile * tile + (from % tile) * tile + to % tile;
+
+    if (m_options.precision == Precision::float16)
+    {
+        std::uint16_t half;
+        std::memcpy(&half, m_data.get() + index * sizeof(half), sizeof(half));
+        return from_half(half);
+    }
+
+    float single;
+    std::memcpy(&single, m_data.get() + index * sizeof(single), sizeof(single));
+    return single;
+}
+
+std::size_t DistanceMatrix::size() const noexcept
+{
+    return m_size;
+}
+
+double DistanceMatrix::radius() const noexcept
+{
+    return m_radius;
+}
+
+const DistanceMatrix::Options& DistanceMatrix::options() const noexcept
+{
+    return m_options;
+}
+
+bool DistanceMatrix::empty() const noexcept
+{
+    return m_data == nullptr;
+}
+
+NearestNeighbours nearest_neighbours(const std::vector<State>& states, double radius, std::size_t k,
+                                     std::size_t threads)
+{
+    constexpr std::size_t row_block    = 64;
+    constexpr std::size_t column_block = 4096;
+
+    const auto n = states.size();
+
+    NearestNeighbours result;
+    result.k = std::min(k, n > 0 ? n - 1 : 0);
+    if (result.k == 0)
+    {
+        return result;
+    }
+    result.index.resize(n * result.k);
+    result.length.resize(n * result.k);
+
+    const auto blocks = (n + row_block - 1) / row_block;
+    detail::parallel_for(blocks, threads, [&](std::size_t begin, std::size_t end) {
+        using Entry = std::pair<double, std::uint32_t>;
+
+        std::vector<std::vector<Entry>> heaps(row_block);
+        std::vector<State>              goals;
+        std::vector<double>             lengths;
+
+        for (auto block = begin; block < end; ++block)
+        {
+            const auto row0 = block * row_block;
+            const auto row1 = std::min(n, row0 + row_block);
+            for (auto& heap : heaps)
+            {
+                heap.clear();
+            }
+
+            // Each column block is solved against every row of the row block while it is hot in cache
+            for (std::size_t col0 = 0; col0 < n; col0 += column_block)
+            {
+                const auto col1 = std::min(n, col0 + column_block);
+                goals.assign(states.begin() + std::ptrdiff_t(col0), states.begin() + std::ptrdiff_t(col1));
+
+                for (auto row = row0; row < row1; ++row)
+                {
+                    auto& heap = heaps[row - row0];
+                    one_to_many(states[row], goals, radius, lengths);
+                    for (auto col = col0; col < col1; ++col)
+                    {
+                        const Entry entry{lengths[col - col0], static_cast<std::uint32_t>(col)};
+                        if (col == row || (heap.size() == result.k && !(entry < heap.front())))
+                        {
+                            continue;
+                        }
+                        if (heap.size() == result.k)
+                        {
+                            std::pop_heap(heap.begin(), heap.end());
+                            heap.pop_back();
+                        }
+                        heap.push_back(entry);
+                        std::push_heap(heap.begin(), heap.end());
+                    }
+                }
+            }
+
+            for (auto row = row0; row < row1; ++row)
+            {
+                auto& heap = heaps[row - row0];
+                std::sort_heap(heap.begin(), heap.end());
+                for (std::size_t i = 0; i < result.k; ++i)
+                {
+                    result.length[row * result.k + i] = heap[i].first;
+                    result.index[row * result.k + i]  = heap[i].second;
+                }
+            }
+        }
+    });
+
+    return result;
+}
+
+}    // namespace dubins
@@ -2,12 +2,18 @@
 #include "dubins/Angle.hpp"
 #include "dubins/Circle.hpp"
 #include "dubins/Line.hpp"
+#include "dubins/Primitive.hpp"
+#include "dubins/Trig.hpp"
 #include "dubins/Vector.hpp"
+#include <array>
 #include <cmath>
 #include <cstdint>
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
 #include <vector>
 
 #include "dubins/output.hpp"
@@ -42,11 +48,40 @@ double arc_length(const RightArc& arc)
 
 Angle get_angle_on_circle(const Vector2D& point, const Circle& circle) noexcept
 {
-    const auto v = point - circle.center;
-    return Angle{std::atan2(v.y, v.x)};
+    return Angle{angle_of(point - circle.center)};
 }
 
-double get_segments_impl(std::vector<State>& segments, const LeftArc& arc, double segment_length, double dist) noexcept
+Primitive to_primitive(const LeftArc& arc) noexcept
+{
+    ArcPrimitive primitive;
+    primitive.center      = arc.circle.center;
+    primitive.radius      = arc.circle.radius;
+    primitive.start_angle = (double)arc.start_angle;
+    primitive.end_angle   = (double)arc.end_angle;
+    primitive.sweep       = Angle::positive_difference(arc.end_angle, arc.start_angle);
+    primitive.direction   = SegmentType::left;
+    return primitive;
+}
+
+Primitive to_primitive(const RightArc& arc) noexcept
+{
+    ArcPrimitive primitive;
+    primitive.center      = arc.circle.center;
+    primitive.radius      = arc.circle.radius;
+    primitive.start_angle = (double)arc.start_angle;
+    primitive.end_angle   = (double)arc.end_angle;
+    primitive.sweep       = -std::abs(Angle::negative_difference(arc.end_angle, arc.start_angle));
+    primitive.direction   = SegmentType::right;
+    return primitive;
+}
+
+Primitive to_primitive(const Line2D& line) noexcept
+{
+    return line;
+}
+
+template<typename Segments>
+double get_segments_impl(Segments& segments, const LeftArc& arc, double segment_length, double dist)
 {
     const auto start_angle     = (double)arc.start_angle + dist / arc.circle.radius;    // Angle of first point
     const auto rad_per_segment = segment_length / arc.circle.radius;
@@ -71,7 +106,8 @@ double get_segments_impl(std::vector<State>& segments, const LeftArc& arc, doubl
     return (max_angle - (angle - rad_per_segment)) * arc.circle.radius;
 }
 
-double get_segments_impl(std::vector<State>& segments, const RightArc& arc, double segment_length, double dist) noexcept
+template<typename Segments>
+double get_segments_impl(Segments& segments, const RightArc& arc, double segment_length, double dist)
 {
     const auto start_angle     = (double)arc.start_angle - dist / arc.circle.radius;    // Angle of first point
     const auto rad_per_segment = segment_length / arc.circle.radius;
@@ -97,12 +133,13 @@ double get_segments_impl(std::vector<State>& segments, const RightArc& arc, doub
     return (max_angle - (angle - rad_per_segment)) * arc.circle.radius;
 }
 
-double get_segments_impl(std::vector<State>& segments, const Line2D& line, double segment_length, double dist) noexcept
+template<typename Segments>
+double get_segments_impl(Segments& segments, const Line2D& line, double segment_length, double dist)
 {
     const auto v        = line.b - line.a;
     const auto len      = norm(v);
     const auto v_norm   = v / len;
-    const auto heading  = std::atan2(v.y, v.x);
+    const auto heading  = angle_of(v);
     auto       distance = dist;
 
     while (distance <= len)
@@ -125,6 +162,12 @@ class PathBase
     virtual ~PathBase() noexcept                                                 = default;
     virtual std::vector<State> get_segments(const Dubins::Options& opt) noexcept = 0;
     virtual double             get_length() noexcept                             = 0;
+
+    virtual std::pmr::vector<State> get_segments(const Dubins::Options&        opt,
+                                                 std::pmr::memory_resource* resource) = 0;
+
+    virtual std::array<double, 3> get_segment_lengths() const noexcept = 0;
+    virtual Primitives            get_primitives() const noexcept      = 0;
 };
 
 template<typename StartArc, typename EndArc>
@@ -138,7 +181,17 @@ class CSCPath : public PathBase
 
         if (line.has_value() == false)
         {
-            return;
+            // Coincident circles have no unique tangent, the path degenerates to a single arc on the shared circle.
+            const auto same_circle = std::is_same_v<StartArc, EndArc>
+                                     && norm_sq(m_end.circle.center - m_start.circle.center) == 0.0
+                                     && m_end.circle.radius == m_start.circle.radius;
+            if (same_circle == false)
+            {
+                return;
+            }
+
+            const auto p = m_start.circle.center + m_start.circle.radius * unit_vector((double)m_start.start_angle);
+            line         = Line2D{p, p};
         }
 
         m_mid = line.value();
@@ -152,13 +205,27 @@ class CSCPath : public PathBase
         const auto d_mid   = length(m_mid);
         const auto d_end   = arc_length(m_end);
 
-        m_length = d_start + d_mid + d_end;
+        m_segments = {d_start, d_mid, d_end};
+        m_length   = d_start + d_mid + d_end;
     }
 
     std::vector<State> get_segments(const Dubins::Options& opt) noexcept final
     {
         std::vector<State> segments;
+        fill_segments(segments, opt);
+        return segments;
+    }
+
+    std::pmr::vector<State> get_segments(const Dubins::Options& opt, std::pmr::memory_resource* resource) final
+    {
+        std::pmr::vector<State> segments{resource};
+        fill_segments(segments, opt);
+        return segments;
+    }
 
+    template<typename Segments>
+    void fill_segments(Segments& segments, const Dubins::Options& opt) const
+    {
         const auto num_segments   = std::floor(m_length / opt.max_segment_length) + 1;
         const auto segment_length = m_length / std::max(double(opt.min_number_of_segments), num_segments);
 
@@ -167,16 +234,22 @@ class CSCPath : public PathBase
         remain = get_segments_impl(segments, m_start, segment_length, 0.0);
         remain = get_segments_impl(segments, m_mid, segment_length, segment_length - remain);
         remain = get_segments_impl(segments, m_end, segment_length, segment_length - remain);
-
-        return segments;
     }
 
     double get_length() noexcept final { return m_length; }
 
-    StartArc m_start;
-    Line2D   m_mid;
-    EndArc   m_end;
-    double   m_length{std::numeric_limits<double>::infinity()};
+    std::array<double, 3> get_segment_lengths() const noexcept final { return m_segments; }
+
+    Primitives get_primitives() const noexcept final
+    {
+        return {to_primitive(m_start), to_primitive(m_mid), to_primitive(m_end)};
+    }
+
+    StartArc              m_start;
+    Line2D                m_mid;
+    EndArc                m_end;
+    double                m_length{std::numeric_limits<double>::infinity()};
+    std::array<double, 3> m_segments{};
 };
 
 template<typename StartArc, typename MidArc>
@@ -208,13 +281,27 @@ class CCCPath : public PathBase
         const auto d_mid   = arc_length(m_mid);
         const auto d_end   = arc_length(m_end);
 
-        m_length = d_start + d_mid + d_end;
+        m_segments = {d_start, d_mid, d_end};
+        m_length   = d_start + d_mid + d_end;
     }
 
     std::vector<State> get_segments(const Dubins::Options& opt) noexcept final
     {
         std::vector<State> segments;
+        fill_segments(segments, opt);
+        return segments;
+    }
 
+    std::pmr::vector<State> get_segments(const Dubins::Options& opt, std::pmr::memory_resource* resource) final
+    {
+        std::pmr::vector<State> segments{resource};
+        fill_segments(segments, opt);
+        return segments;
+    }
+
+    template<typename Segments>
+    void fill_segments(Segments& segments, const Dubins::Options& opt) const
+    {
         const auto num_segments   = std::ceil(m_length / opt.max_segment_length);
         const auto segment_length = m_length / std::max(double(opt.min_number_of_segments), num_segments);
 
@@ -223,52 +310,50 @@ class CCCPath : public PathBase
         remain = get_segments_impl(segments, m_start, segment_length, 0.0);
         remain = get_segments_impl(segments, m_mid, segment_length, segment_length - remain);
         remain = get_segments_impl(segments, m_end, segment_length, segment_length - remain);
-
-        return segments;
     }
 
     double get_length() noexcept final { return m_length; }
 
-    StartArc m_start;
-    MidArc   m_mid;
-    StartArc m_end;
-    double   m_length{std::numeric_limits<double>::infinity()};
+    std::array<double, 3> get_segment_lengths() const noexcept final { return m_segments; }
+
+    Primitives get_primitives() const noexcept final
+    {
+        return {to_primitive(m_start), to_primitive(m_mid), to_primitive(m_end)};
+    }
+
+    StartArc              m_start;
+    MidArc                m_mid;
+    StartArc              m_end;
+    double                m_length{std::numeric_limits<double>::infinity()};
+    std::array<double, 3> m_segments{};
 };
 
 // Object to initialize starting and ending circular arcs
 class Arcs
 {
     public:
-    Arcs(const State& start, const State& end, const double radius)
+    Arcs(const State& start, const State& end, const double radius) :
+        Arcs(turning_circles(start, radius), turning_circles(end, radius))
     {
-        const auto start_u     = Vector2D{std::cos(start.heading + M_PI_2), std::sin(start.heading + M_PI_2)};
-        const auto start_left  = start.position + radius * start_u;
-        const auto start_right = start.position - radius * start_u;
-
-        m_start_left.circle.center = start_left;
-        m_start_left.circle.radius = radius;
-        m_start_left.start_angle   = start.heading - M_PI_2;
-        m_start_left.end_angle     = m_start_left.start_angle;
-
-        m_start_right.circle.center = start_right;
-        m_start_right.circle.radius = radius;
-        m_start_right.start_angle   = start.heading + M_PI_2;
-        m_start_right.end_angle     = m_start_right.start_angle;
-
-        const auto end_u     = Vector2D{std::cos(end.heading + M_PI_2), std::sin(end.heading + M_PI_2)};
-        const auto end_left  = end.position + radius * end_u;
-        const auto end_right = end.position - radius * end_u;
-        const auto end_ang   = start.heading - M_PI_2;
-
-        m_end_left.circle.center = end_left;
-        m_end_left.circle.radius = radius;
-        m_end_left.start_angle   = end.heading - M_PI_2;
-        m_end_left.end_angle     = m_end_left.start_angle;
-
-        m_end_right.circle.center = end_right;
-        m_end_right.circle.radius = radius;
-        m_end_right.start_angle   = end.heading + M_PI_2;
-        m_end_right.end_angle     = m_end_right.start_angle;
+    }
+
+    Arcs(const TurningCircles& start, const TurningCircles& end)
+    {
+        m_start_left.circle      = start.left;
+        m_start_left.start_angle = start.state.heading - M_PI_2;
+        m_start_left.end_angle   = m_start_left.start_angle;
+
+        m_start_right.circle      = start.right;
+        m_start_right.start_angle = start.state.heading + M_PI_2;
+        m_start_right.end_angle   = m_start_right.start_angle;
+
+        m_end_left.circle      = end.left;
+        m_end_left.start_angle = end.state.heading - M_PI_2;
+        m_end_left.end_angle   = m_end_left.start_angle;
+
+        m_end_right.circle      = end.right;
+        m_end_right.start_angle = end.state.heading + M_PI_2;
+        m_end_right.end_angle   = m_end_right.start_angle;
     }
 
     LeftArc  m_start_left;
@@ -277,25 +362,38 @@ class Arcs
     RightArc m_end_right;
 };
 
+template<typename Segments>
+void segmented_path_impl(const PathDescriptor& path, const Dubins::Options& options, Segments& segments)
+{
+    const auto len            = length(path);
+    const auto num_segments   = std::max(double(options.min_number_of_segments),
+                                         std::ceil(len / options.max_segment_length));
+    const auto segment_length = len / num_segments;
+
+    sample(path, 0.0, segment_length, static_cast<std::size_t>(num_segments) + 1, segments);
+}
+
 }    // namespace
 
 // Object to calculate path information
 class Dubins::Path
 {
     public:
-    Path(const State& start, const State& end, const double radius) : m_arcs(start, end, radius)
+    Path(const State& start, const State& end, const double radius) :
+        m_arcs(start, end, radius),
+        m_lsl(m_arcs.m_start_left, m_arcs.m_end_left),
+        m_rsr(m_arcs.m_start_right, m_arcs.m_end_right),
+        m_rsl(m_arcs.m_start_right, m_arcs.m_end_left),
+        m_lsr(m_arcs.m_start_left, m_arcs.m_end_right),
+        m_lrl(m_arcs.m_start_left, m_arcs.m_end_left),
+        m_rlr(m_arcs.m_start_right, m_arcs.m_end_right),
+        m_start{start},
+        m_radius{radius}
     {
-        m_paths[0] = std::make_unique<CSCPath<LeftArc, LeftArc>>(m_arcs.m_start_left, m_arcs.m_end_left);
-        m_paths[1] = std::make_unique<CSCPath<RightArc, RightArc>>(m_arcs.m_start_right, m_arcs.m_end_right);
-        m_paths[2] = std::make_unique<CSCPath<RightArc, LeftArc>>(m_arcs.m_start_right, m_arcs.m_end_left);
-        m_paths[3] = std::make_unique<CSCPath<LeftArc, RightArc>>(m_arcs.m_start_left, m_arcs.m_end_right);
-        m_paths[4] = std::make_unique<CCCPath<LeftArc, RightArc>>(m_arcs.m_start_left, m_arcs.m_end_left);
-        m_paths[5] = std::make_unique<CCCPath<RightArc, LeftArc>>(m_arcs.m_start_right, m_arcs.m_end_right);
-
         double       len = std::numeric_limits<double>::infinity();
         std::int64_t idx = 0;
 
-        for (const auto& path : m_paths)
+        for (auto* path : m_paths)
         {
             if (path->get_length() < len)
             {
@@ -306,21 +404,66 @@ class Dubins::Path
         }
     }
 
+    Path(const Path&)            = delete;
+    Path& operator=(const Path&) = delete;
+
     double             length() noexcept { return m_paths[m_idx]->get_length(); }
     std::vector<State> segments(const Options& opt) { return m_paths[m_idx]->get_segments(opt); };
 
     std::vector<State> segments_idx(std::size_t idx, const Options& opt) { return m_paths[idx]->get_segments(opt); }
 
+    std::pmr::vector<State> segments_idx(std::size_t idx, const Options& opt, std::pmr::memory_resource* resource)
+    {
+        return m_paths[idx]->get_segments(opt, resource);
+    }
+
+    std::size_t index() const noexcept { return static_cast<std::size_t>(m_idx); }
+
+    Primitives primitives() const noexcept { return m_paths[m_idx]->get_primitives(); }
+
+    PathDescriptor descriptor() const noexcept
+    {
+        PathDescriptor path;
+        path.start    = m_start;
+        path.radius   = m_radius;
+        path.word     = static_cast<Word>(m_idx);
+        path.segments = m_paths[m_idx]->get_segment_lengths();
+        return path;
+    }
+
 
     private:
-    Arcs                                     m_arcs;
-    std::array<std::unique_ptr<PathBase>, 6> m_paths;
-    std::int64_t                             m_idx{-1};
+    // Candidates are stored inline so a path costs a single allocation from its memory resource
+    Arcs                        m_arcs;
+    CSCPath<LeftArc, LeftArc>   m_lsl;
+    CSCPath<RightArc, RightArc> m_rsr;
+    CSCPath<RightArc, LeftArc>  m_rsl;
+    CSCPath<LeftArc, RightArc>  m_lsr;
+    CCCPath<LeftArc, RightArc>  m_lrl;
+    CCCPath<RightArc, LeftArc>  m_rlr;
+    std::array<PathBase*, 6>    m_paths{&m_lsl, &m_rsr, &m_rsl, &m_lsr, &m_lrl, &m_rlr};
+    std::int64_t                m_idx{-1};
+    State                       m_start;
+    double                      m_radius{1.0};
 };
 
+void Dubins::PathDeleter::operator()(Path* path) const noexcept
+{
+    path->~Path();
+    resource->deallocate(path, sizeof(Path), alignof(Path));
+}
+
 Dubins::Dubins(const State& start, const State& end, const Options& options) noexcept :
-    pimpl{std::make_unique<Path>(start, end, options.turning_radius)}
+    Dubins(start, end, options, std::pmr::get_default_resource())
+{
+}
+
+Dubins::Dubins(const State& start, const State& end, const Options& options,
+               std::pmr::memory_resource* resource) :
+    pimpl{nullptr, PathDeleter{resource}}
 {
+    auto* memory = resource->allocate(sizeof(Path), alignof(Path));
+    pimpl.reset(new (memory) Path(start, end, options.turning_radius));
 }
 
 Dubins::~Dubins() = default;
@@ -335,35 +478,245 @@ std::vector<State> Dubins::segmented_path(const Options& options) noexcept
     return pimpl->segments(options);
 }
 
+std::pmr::vector<State> Dubins::segmented_path(const Options& options, std::pmr::memory_resource* resource)
+{
+    return pimpl->segments_idx(pimpl->index(), options, resource);
+}
+
+std::vector<State> Dubins::adaptive_path(double max_chord_error) const noexcept
+{
+    return dubins::adaptive_path(pimpl->descriptor(), max_chord_error);
+}
+
+std::pmr::vector<State> Dubins::adaptive_path(double max_chord_error, std::pmr::memory_resource* resource) const
+{
+    return dubins::adaptive_path(pimpl->descriptor(), max_chord_error, resource);
+}
+
+Primitives Dubins::primitives() const noexcept
+{
+    return pimpl->primitives();
+}
+
+PathDescriptor Dubins::descriptor() const noexcept
+{
+    return pimpl->descriptor();
+}
+
 std::vector<State> Dubins::segmented_lsl(const Options& options) noexcept
 {
     return pimpl->segments_idx(0U, options);
 }
 
+std::pmr::vector<State> Dubins::segmented_lsl(const Options& options, std::pmr::memory_resource* resource)
+{
+    return pimpl->segments_idx(0U, options, resource);
+}
+
 std::vector<State> Dubins::segmented_rsr(const Options& options) noexcept
 {
     return pimpl->segments_idx(1U, options);
 }
 
+std::pmr::vector<State> Dubins::segmented_rsr(const Options& options, std::pmr::memory_resource* resource)
+{
+    return pimpl->segments_idx(1U, options, resource);
+}
+
 std::vector<State> Dubins::segmented_rsl(const Options& options) noexcept
 {
     return pimpl->segments_idx(2U, options);
 }
 
+std::pmr::vector<State> Dubins::segmented_rsl(const Options& options, std::pmr::memory_resource* resource)
+{
+    return pimpl->segments_idx(2U, options, resource);
+}
+
 std::vector<State> Dubins::segmented_lsr(const Options& options) noexcept
 {
     return pimpl->segments_idx(3U, options);
 }
 
+std::pmr::vector<State> Dubins::segmented_lsr(const Options& options, std::pmr::memory_resource* resource)
+{
+    return pimpl->segments_idx(3U, options, resource);
+}
+
 std::vector<State> Dubins::segmented_lrl(const Options& options) noexcept
 {
     return pimpl->segments_idx(4U, options);
 }
 
+std::pmr::vector<State> Dubins::segmented_lrl(const Options& options, std::pmr::memory_resource* resource)
+{
+    return pimpl->segments_idx(4U, options, resource);
+}
+
 std::vector<State> Dubins::segmented_rlr(const Options& options) noexcept
 {
     return pimpl->segments_idx(5U, options);
 }
 
+std::pmr::vector<State> Dubins::segmented_rlr(const Options& options, std::pmr::memory_resource* resource)
+{
+    return pimpl->segments_idx(5U, options, resource);
+}
+
+TurningCircles turning_circles(const State& state, double radius) noexcept
+{
+    const auto u = unit_vector(state.heading + M_PI_2);
+
+    TurningCircles circles;
+    circles.state        = state;
+    circles.left.center  = state.position + radius * u;
+    circles.left.radius  = radius;
+    circles.right.center = state.position - radius * u;
+    circles.right.radius = radius;
+    return circles;
+}
+
+PathDescriptor shortest_path(const State& start, const State& end, double radius) noexcept
+{
+    return shortest_path(turning_circles(start, radius), turning_circles(end, radius));
+}
+
+PathDescriptor shortest_path(const TurningCircles& start, const TurningCircles& end) noexcept
+{
+    // Same candidates as Dubins::Path, but kept on the stack
+    const Arcs arcs(start, end);
+
+    CSCPath<LeftArc, LeftArc>   lsl(arcs.m_start_left, arcs.m_end_left);
+    CSCPath<RightArc, RightArc> rsr(arcs.m_start_right, arcs.m_end_right);
+    CSCPath<RightArc, LeftArc>  rsl(arcs.m_start_right, arcs.m_end_left);
+    CSCPath<LeftArc, RightArc>  lsr(arcs.m_start_left, arcs.m_end_right);
+    CCCPath<LeftArc, RightArc>  lrl(arcs.m_start_left, arcs.m_end_left);
+    CCCPath<RightArc, LeftArc>  rlr(arcs.m_start_right, arcs.m_end_right);
+
+    const std::array<PathBase*, 6> paths{&lsl, &rsr, &rsl, &lsr, &lrl, &rlr};
+
+    PathDescriptor path;
+    path.start    = start.state;
+    path.radius   = start.left.radius;
+    path.segments = {std::numeric_limits<double>::infinity(), 0.0, 0.0};
+
+    double len = std::numeric_limits<double>::infinity();
+    for (std::size_t idx = 0; idx < paths.size(); ++idx)
+    {
+        if (paths[idx]->get_length() < len)
+        {
+            len           = paths[idx]->get_length();
+            path.word     = static_cast<Word>(idx);
+            path.segments = paths[idx]->get_segment_lengths();
+        }
+    }
+
+    return path;
+}
+
+std::vector<State> segmented_path(const PathDescriptor& path, const Dubins::Options& options)
+{
+    std::vector<State> segments;
+    segmented_path_impl(path, options, segments);
+    return segments;
+}
+
+std::pmr::vector<State> segmented_path(const PathDescriptor& path, const Dubins::Options& options,
+                                       std::pmr::memory_resource* resource)
+{
+    std::pmr::vector<State> segments{resource};
+    segmented_path_impl(path, options, segments);
+    return segments;
+}
+
+std::vector<State> adaptive_path(const PathDescriptor& path, double max_chord_error)
+{
+    std::vector<State> states;
+    if (max_chord_error > 0.0)
+    {
+        states.push_back(state_at(path, 0.0));
+        sample_adaptive(path, max_chord_error, states);
+    }
+    return states;
+}
+
+std::pmr::vector<State> adaptive_path(const PathDescriptor& path, double max_chord_error,
+                                      std::pmr::memory_resource* resource)
+{
+    std::pmr::vector<State> states{resource};
+    if (max_chord_error > 0.0)
+    {
+        states.push_back(state_at(path, 0.0));
+        sample_adaptive(path, max_chord_error, states);
+    }
+    return states;
+}
+
+PathDescriptor word_path(const TurningCircles& start, const TurningCircles& end, Word word) noexcept
+{
+    const Arcs arcs(start, end);
+
+    PathDescriptor path;
+    path.start  = start.state;
+    path.radius = start.left.radius;
+    path.word   = word;
+
+    std::array<double, 3> segments;
+    double                len = std::numeric_limits<double>::infinity();
+
+    switch (word)
+    {
+        case Word::LSL:
+        {
+            CSCPath<LeftArc, LeftArc> candidate(arcs.m_start_left, arcs.m_end_left);
+            len      = candidate.get_length();
+            segments = candidate.get_segment_lengths();
+            break;
+        }
+        case Word::RSR:
+        {
+            CSCPath<RightArc, RightArc> candidate(arcs.m_start_right, arcs.m_end_right);
+            len      = candidate.get_length();
+            segments = candidate.get_segment_lengths();
+            break;
+        }
+        case Word::RSL:
+        {
+            CSCPath<RightArc, LeftArc> candidate(arcs.m_start_right, arcs.m_end_left);
+            len      = candidate.get_length();
+            segments = candidate.get_segment_lengths();
+            break;
+        }
+        case Word::LSR:
+        {
+            CSCPath<LeftArc, RightArc> candidate(arcs.m_start_left, arcs.m_end_right);
+            len      = candidate.get_length();
+            segments = candidate.get_segment_lengths();
+            break;
+        }
+        case Word::LRL:
+        {
+            CCCPath<LeftArc, RightArc> candidate(arcs.m_start_left, arcs.m_end_left);
+            len      = candidate.get_length();
+            segments = candidate.get_segment_lengths();
+            break;
+        }
+        case Word::RLR:
+        {
+            CCCPath<RightArc, LeftArc> candidate(arcs.m_start_right, arcs.m_end_right);
+            len      = candidate.get_length();
+            segments = candidate.get_segment_lengths();
+            break;
+        }
+    }
+
+    path.segments = std::isfinite(len) ? segments : std::array<double, 3>{len, 0.0, 0.0};
+    return path;
+}
+
+PathDescriptor word_path(const State& start, const State& end, double radius, Word word) noexcept
+{
+    return word_path(turning_circles(start, radius), turning_circles(end, radius), word);
+}
 
 };    // namespace dubins
@@ -0,0 +1,194 @@
+#include "dubins/DynamicDistanceMatrix.hpp"
+#include "dubins/OneToMany.hpp"
+
+#include "Parallel.hpp"
+
+#include <algorithm>
+
+namespace dubins
+{
+namespace
+{
+// Columns solved per one_to_many() call, large enough to amortize the call and small enough to split across threads
+constexpr std::size_t block_size = 1024;
+
+}    // namespace
+
+DynamicDistanceMatrix::DynamicDistanceMatrix(double radius, std::size_t threads) : m_radius{radius}, m_threads{threads}
+{
+}
+
+DynamicDistanceMatrix::Id DynamicDistanceMatrix::insert(const State& state)
+{
+    Id id;
+    if (m_free.empty())
+    {
+        id = static_cast<Id>(m_states.size());
+        reserve(m_states.size() + 1);
+        m_states.push_back(state);
+        m_alive.push_back(true);
+    }
+    else
+    {
+        id = m_free.back();
+        m_free.pop_back();
+        m_states[id] = state;
+        m_alive[id]  = true;
+    }
+
+    recompute(id);
+    return id;
+}
+
+void DynamicDistanceMatrix::erase(Id id)
+{
+    if (!contains(id))
+    {
+        return;
+    }
+    m_alive[id] = false;
+    m_free.push_back(id);
+}
+
+void DynamicDistanceMatrix::update(Id id, const State& state)
+{
+    if (!contains(id))
+    {
+        return;
+    }
+    m_states[id] = state;
+    recompute(id);
+}
+
+std::vector<DynamicDistanceMatrix::Id> DynamicDistanceMatrix::compact()
+{
+    std::vector<Id> remap(m_states.size(), invalid_id);
+    std::vector<Id> kept;
+    for (Id id = 0; id < m_states.size(); ++id)
+    {
+        if (m_alive[id])
+        {
+            remap[id] = static_cast<Id>(kept.size());
+            kept.push_back(id);
+        }
+    }
+
+    const auto          n = kept.size();
+    std::vector<double> lengths(n * n);
+    std::vector<State>  states(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        states[i] = m_states[kept[i]];
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            lengths[i * n + j] = m_lengths[std::size_t(kept[i]) * m_capacity + kept[j]];
+        }
+    }
+
+    m_capacity = n;
+    m_states   = std::move(states);
+    m_lengths  = std::move(lengths);
+    m_alive.assign(n, true);
+    m_free.clear();
+
+    return remap;
+}
+
+double DynamicDistanceMatrix::at(Id from, Id to) const noexcept
+{
+    return m_lengths[std::size_t(from) * m_capacity + to];
+}
+
+const State& DynamicDistanceMatrix::state(Id id) const noexcept
+{
+    return m_states[id];
+}
+
+bool DynamicDistanceMatrix::contains(Id id) const noexcept
+{
+    return id < m_states.size() && m_alive[id];
+}
+
+std::vector<DynamicDistanceMatrix::Id> DynamicDistanceMatrix::ids() const
+{
+    std::vector<Id> result;
+    result.reserve(size());
+    for (Id id = 0; id < m_states.size(); ++id)
+    {
+        if (m_alive[id])
+        {
+            result.push_back(id);
+        }
+    }
+    return result;
+}
+
+std::size_t DynamicDistanceMatrix::size() const noexcept
+{
+    return m_states.size() - m_free.size();
+}
+
+std::size_t DynamicDistanceMatrix::slots() const noexcept
+{
+    return m_states.size();
+}
+
+double DynamicDistanceMatrix::radius() const noexcept
+{
+    return m_radius;
+}
+
+void DynamicDistanceMatrix::reserve(std::size_t capacity)
+{
+    if (capacity <= m_capacity)
+    {
+        return;
+    }
+
+    // Grow geometrically so a sequence of inserts copies the matrix a logarithmic number of times
+    const auto          grown = std::max(capacity, 2 * m_capacity);
+    std::vector<double> lengths(grown * grown);
+    for (std::size_t i = 0; i < m_states.size(); ++i)
+    {
+        std::copy_n(m_lengths.begin() + std::ptrdiff_t(i * m_capacity), m_states.size(),
+                    lengths.begin() + std::ptrdiff_t(i * grown));
+    }
+
+    m_capacity = grown;
+    m_lengths  = std::move(lengths);
+}
+
+void DynamicDistanceMatrix::recompute(Id id)
+{
+    // Removed slots are solved as well, their entries are simply never read. That keeps every block contiguous.
+    const auto  n      = m_states.size();
+    const auto  blocks = (n + block_size - 1) / block_size;
+    const auto& moved  = m_states[id];
+    auto*       row    = m_lengths.data() + std::size_t(id) * m_capacity;
+
+    detail::parallel_for(blocks, m_threads, [&](std::size_t begin, std::size_t end) {
+        std::vector<State>  others;
+        std::vector<double> to;
+        std::vector<double> from;
+
+        for (auto block = begin; block < end; ++block)
+        {
+            const auto first = block * block_size;
+            const auto last  = std::min(n, first + block_size);
+
+            others.assign(m_states.begin() + std::ptrdiff_t(first), m_states.begin() + std::ptrdiff_t(last));
+            one_to_many(moved, others, m_radius, to);
+            many_to_one(others, moved, m_radius, from);
+
+            std::copy(to.begin(), to.end(), row + first);
+            for (auto j = first; j < last; ++j)
+            {
+                m_lengths[j * m_capacity + id] = from[j - first];
+            }
+        }
+    });
+
+    row[id] = 0.0;
+}
+
+}    // namespace dubins
@@ -0,0 +1,216 @@
+#include "dubins/FreeHeading.hpp"
+#include "dubins/Angle.hpp"
+#include "dubins/Trig.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+namespace dubins
+{
+namespace
+{
+constexpr double infinity = std::numeric_limits<double>::infinity();
+
+// Free heading candidates: LS, RS and both solutions of LR and RL
+using Candidates = std::array<FreeHeadingPath, 6>;
+
+double wrapped(double heading) noexcept
+{
+    return Angle::signed_difference(Angle{heading}, Angle{0.0});
+}
+
+FreeHeadingPath infeasible(const State& start, double radius) noexcept
+{
+    FreeHeadingPath result;
+    result.path.start    = start;
+    result.path.radius   = radius;
+    result.path.segments = {infinity, 0.0, 0.0};
+    return result;
+}
+
+FreeHeadingPath make_path(const State& start, double radius, Word word, double first, double second,
+                          double heading) noexcept
+{
+    FreeHeadingPath result;
+    result.path.start    = start;
+    result.path.radius   = radius;
+    result.path.word     = word;
+    result.path.segments = {first, second, 0.0};
+    result.heading       = wrapped(heading);
+    return result;
+}
+
+// Arc length swept turning from one angle on a circle to another
+double sweep(Angle from, Angle to, bool left) noexcept
+{
+    return left ? Angle::positive_difference(to, from) : -Angle::negative_difference(to, from);
+}
+
+// Turn onto the tangent from the turning circle to the goal, then drive straight to it. A point is a circle of radius
+// zero, so this is the transfer line between the turning circle and the goal.
+template<typename Directed>
+FreeHeadingPath turn_straight(const State& start, const Directed& circle, const Vector2D& goal, Word word) noexcept
+{
+    const auto line = calculate_transfer_line(circle, Directed{Circle{goal, 0.0}});
+    if (!line)
+    {
+        return infeasible(start, circle.radius);
+    }
+
+    const auto from  = Angle{angle_of(start.position - circle.center)};
+    const auto to    = Angle{angle_of(line->a - circle.center)};
+    const auto first = circle.radius * sweep(from, to, word == Word::LSL);
+
+    return make_path(start, circle.radius, word, first, length(*line), angle_of(line->b - line->a));
+}
+
+// Centers of the transfer circles tangent to a turning circle at a distance from a target. A transfer circle has the
+// same radius, so its center is 2r from the turning circle's center. Returns the number of centers.
+std::size_t transfer_centers(const Circle& circle, const Vector2D& target, double distance,
+                             std::array<Vector2D, 2>& out) noexcept
+{
+    const auto r = circle.radius;
+    const auto v = target - circle.center;
+    const auto d = norm(v);
+    if (d == 0.0 || d < std::abs(2.0 * r - distance) * (1.0 - 1e-12) || d > 2.0 * r + distance)
+    {
+        return 0;
+    }
+
+    const auto u = v / d;
+    const auto a = (4.0 * r * r - distance * distance + d * d) / (2.0 * d);
+    const auto h = std::sqrt(std::max(0.0, 4.0 * r * r - a * a));
+
+    out[0] = circle.center + a * u + h * perpendicular(u);
+    out[1] = circle.center + a * u - h * perpendicular(u);
+    return 2;
+}
+
+// Turn onto a transfer circle of the opposite direction that passes through the goal, which has two solutions while
+// r <= d <= 3r.
+void turn_turn(const State& start, const Circle& circle, bool left, const Vector2D& goal,
+               FreeHeadingPath* out) noexcept
+{
+    const auto r = circle.radius;
+
+    out[0] = infeasible(start, r);
+    out[1] = infeasible(start, r);
+
+    std::array<Vector2D, 2> centers;
+    const auto              count = transfer_centers(circle, goal, r, centers);
+
+    const auto from = Angle{angle_of(start.position - circle.center)};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto to    = Angle{angle_of(centers[i] - circle.center)};
+        const auto enter = Angle{angle_of(circle.center - centers[i])};
+        const auto leave = angle_of(goal - centers[i]);
+
+        const auto first   = r * sweep(from, to, left);
+        const auto second  = r * sweep(enter, Angle{leave}, !left);
+        const auto heading = left ? leave - M_PI_2 : leave + M_PI_2;
+        out[i]             = make_path(start, r, left ? Word::LRL : Word::RLR, first, second, heading);
+    }
+}
+
+// Shortest path arriving with a fixed heading. calculate_transfer_circle() only admits turning circles up to 2sqrt(3)r
+// apart, so the turn-turn-turn paths up to the full 4r are added here to keep the interval solution optimal.
+FreeHeadingPath boundary(const State& start, const Vector2D& goal, double heading, double radius) noexcept
+{
+    FreeHeadingPath result;
+    result.path    = shortest_path(start, {goal, heading}, radius);
+    result.heading = wrapped(heading);
+
+    const auto from = turning_circles(start, radius);
+    const auto to   = turning_circles({goal, heading}, radius);
+    for (const auto left : {true, false})
+    {
+        const Circle first = left ? Circle(from.left) : Circle(from.right);
+        const Circle last  = left ? Circle(to.left) : Circle(to.right);
+
+        std::array<Vector2D, 2> centers;
+        const auto              count = transfer_centers(first, last.center, 2.0 * radius, centers);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto& transfer = centers[i];
+            const auto  depart   = Angle{angle_of(transfer - first.center)};
+            const auto  arrive   = Angle{angle_of(transfer - last.center)};
+
+            PathDescriptor path;
+            path.start    = start;
+            path.radius   = radius;
+            path.word     = left ? Word::LRL : Word::RLR;
+            path.segments = {radius * sweep(Angle{angle_of(start.position - first.center)}, depart, left),
+                             radius * sweep(Angle{double(depart) + M_PI}, Angle{double(arrive) + M_PI}, !left),
+                             radius * sweep(arrive, Angle{angle_of(goal - last.center)}, left)};
+
+            if (length(path) < length(result.path))
+            {
+                result.path = path;
+            }
+        }
+    }
+
+    return result;
+}
+
+Candidates candidates(const State& start, const Vector2D& goal, double radius) noexcept
+{
+    const auto circles = turning_circles(start, radius);
+
+    Candidates result;
+    result[0] = turn_straight(start, circles.left, goal, Word::LSL);
+    result[1] = turn_straight(start, circles.right, goal, Word::RSR);
+    turn_turn(start, circles.left, true, goal, &result[2]);
+    turn_turn(start, circles.right, false, goal, &result[4]);
+    return result;
+}
+
+bool shorter(const FreeHeadingPath& lhs, const FreeHeadingPath& rhs) noexcept
+{
+    return length(lhs.path) < length(rhs.path);
+}
+
+}    // namespace
+
+FreeHeadingPath shortest_path_to_point(const State& start, const Vector2D& goal, double radius) noexcept
+{
+    const auto all = candidates(start, goal, radius);
+    return *std::min_element(all.begin(), all.end(), shorter);
+}
+
+FreeHeadingPath shortest_path_to_interval(const State& start, const Vector2D& goal, double heading_min,
+                                          double heading_max, double radius) noexcept
+{
+    // An interval of a full turn or more allows every heading. Wrapping its span would shrink it to nothing.
+    const auto span = heading_max - heading_min;
+    if (span >= 2.0 * M_PI)
+    {
+        return shortest_path_to_point(start, goal, radius);
+    }
+
+    const auto lower = Angle{heading_min};
+    const auto width = span >= 0.0 ? span : Angle::positive_difference(Angle{heading_max}, lower);
+
+    // Paths to the interval boundaries
+    const auto upper = boundary(start, goal, heading_max, radius);
+    auto       best  = boundary(start, goal, heading_min, radius);
+    best             = shorter(upper, best) ? upper : best;
+
+    // Free heading candidates that already arrive inside the interval
+    for (const auto& candidate : candidates(start, goal, radius))
+    {
+        const auto inside = Angle::positive_difference(Angle{candidate.heading}, lower) <= width + 1e-12;
+        if (inside && shorter(candidate, best))
+        {
+            best = candidate;
+        }
+    }
+
+    return best;
+}
+
+}    // namespace dubins
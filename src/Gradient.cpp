@@ -0,0 +1,311 @@
+#include "dubins/Gradient.hpp"
+#include "dubins/Trig.hpp"
+#include "dubins/Vector.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace dubins
+{
+namespace
+{
+constexpr double tiny = std::numeric_limits<double>::min();
+
+// Derivative of a segment length with respect to the vector between the turning circle centers, and directly (with
+// the centers held fixed) with respect to the start heading, end heading and radius
+struct LocalGradient
+{
+    Vector2D center{0.0, 0.0};
+    double   start_heading{0.0};
+    double   end_heading{0.0};
+    double   radius{0.0};
+};
+
+void axpy(double a, const Gradient& x, Gradient& y) noexcept
+{
+    for (std::size_t i = 0; i < y.size(); ++i)
+    {
+        y[i] += a * x[i];
+    }
+}
+
+Gradient unit(std::size_t index) noexcept
+{
+    Gradient g{};
+    g[index] = 1.0;
+    return g;
+}
+
+// Center of a turning circle is position + side * radius * n(heading) with n(heading) = (-sin, cos), side +1 for left
+Vector2D center_offset(double heading, SegmentType type) noexcept
+{
+    const auto n = unit_vector(heading + M_PI_2);
+    return type == SegmentType::left ? n : -1.0 * n;
+}
+
+// Derivative of the center with respect to the heading, per unit radius
+Vector2D center_rotation(double heading, SegmentType type) noexcept
+{
+    const auto d = -1.0 * unit_vector(heading);
+    return type == SegmentType::left ? d : -1.0 * d;
+}
+
+std::array<LocalGradient, 3> local_gradients(const PathDescriptor& path, const Vector2D& v) noexcept
+{
+    const auto r  = path.radius;
+    const auto d  = std::max(norm(v), tiny);
+    const auto u  = v / d;
+    const auto up = perpendicular(u);
+    const auto t  = path.segments[0];
+    const auto m  = path.segments[1];
+    const auto q  = path.segments[2];
+
+    // Heading of the line between the centers turns with the perpendicular of v
+    const auto dphi = up / d;
+
+    std::array<LocalGradient, 3> g;
+    switch (path.word)
+    {
+        case Word::LSL:
+        case Word::RSR:
+        {
+            // The straight runs between the centers, the arcs turn to and from its heading phi
+            const auto s = path.word == Word::LSL ? 1.0 : -1.0;
+            g[0]         = {s * r * dphi, -s * r, 0.0, t / r};
+            g[1]         = {u, 0.0, 0.0, 0.0};
+            g[2]         = {-s * r * dphi, 0.0, s * r, q / r};
+            break;
+        }
+        case Word::LSR:
+        case Word::RSL:
+        {
+            // The straight heading is psi = phi +- asin(2r / d) and its length p = sqrt(d^2 - 4r^2)
+            const auto s     = path.word == Word::LSR ? 1.0 : -1.0;
+            const auto p     = std::max(std::sqrt(std::max(0.0, d * d - 4.0 * r * r)), tiny);
+            const auto dpsi  = dphi - s * (2.0 * r / (p * d)) * u;
+            const auto dpsir = s * 2.0 / p;
+            g[0]             = {s * r * dpsi, -s * r, 0.0, t / r + s * r * dpsir};
+            g[1]             = {(d / p) * u, 0.0, 0.0, -4.0 * r / p};
+            g[2]             = {s * r * dpsi, 0.0, -s * r, q / r + s * r * dpsir};
+            break;
+        }
+        case Word::LRL:
+        case Word::RLR:
+        {
+            // The middle circle sits at gamma = acos(d / 4r) from the line between the centers
+            const auto s       = path.word == Word::LRL ? 1.0 : -1.0;
+            const auto ratio   = std::min(d / (4.0 * r), 1.0);
+            const auto sin_g   = std::max(std::sqrt(1.0 - ratio * ratio), tiny);
+            const auto dgamma  = (-1.0 / (4.0 * r * sin_g)) * u;
+            const auto dgammar = d / (4.0 * r * r * sin_g);
+            g[0]               = {s * r * dphi + r * dgamma, -s * r, 0.0, t / r + r * dgammar};
+            g[1]               = {2.0 * r * dgamma, 0.0, 0.0, m / r + 2.0 * r * dgammar};
+            g[2]               = {-s * r * dphi + r * dgamma, 0.0, s * r, q / r + r * dgammar};
+            break;
+        }
+    }
+    return g;
+}
+
+bool degenerate(const PathDescriptor& path, const Vector2D& v, double tolerance) noexcept
+{
+    const auto r     = path.radius;
+    const auto types = segment_types(path.word);
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+        // Arcs wrap between no turn and a full turn
+        const auto s = path.segments[k];
+        if (types[k] != SegmentType::straight && (s < tolerance || s > 2.0 * M_PI * r - tolerance))
+        {
+            return true;
+        }
+    }
+
+    const auto d = norm(v);
+    switch (path.word)
+    {
+        case Word::LSL:
+        case Word::RSR: return d < tolerance;
+        case Word::LSR:
+        case Word::RSL: return path.segments[1] < tolerance;
+        case Word::LRL:
+        case Word::RLR: return std::abs(d - 2.0 * std::sqrt(3.0) * r) < tolerance;
+    }
+    return false;
+}
+
+// Move the state and its derivatives along one segment of length l
+void advance_gradient(State& state, std::array<Gradient, 3>& ds, SegmentType type, double r, double l,
+                      const Gradient& dl) noexcept
+{
+    const auto theta = state.heading;
+    const auto next  = advance(state, type, r, l);
+    const auto c0    = std::cos(theta);
+    const auto s0    = std::sin(theta);
+    const auto c1    = std::cos(next.heading);
+    const auto s1    = std::sin(next.heading);
+
+    auto dx = ds[0];
+    auto dy = ds[1];
+    auto dh = ds[2];
+
+    const auto& dtheta = ds[2];
+    const auto  dr     = unit(gradient_index::radius);
+    switch (type)
+    {
+        case SegmentType::straight:
+        {
+            axpy(c0, dl, dx);
+            axpy(-l * s0, dtheta, dx);
+            axpy(s0, dl, dy);
+            axpy(l * c0, dtheta, dy);
+            break;
+        }
+        case SegmentType::left:
+        case SegmentType::right:
+        {
+            const auto s = type == SegmentType::left ? 1.0 : -1.0;
+            axpy(s * r * (c1 - c0), dtheta, dx);
+            axpy(c1, dl, dx);
+            axpy(s * (s1 - s0) - (l / r) * c1, dr, dx);
+            axpy(s * r * (s1 - s0), dtheta, dy);
+            axpy(s1, dl, dy);
+            axpy(-s * (c1 - c0) - (l / r) * s1, dr, dy);
+            axpy(s / r, dl, dh);
+            axpy(-s * l / (r * r), dr, dh);
+            break;
+        }
+    }
+
+    state = next;
+    ds    = {dx, dy, dh};
+}
+
+}    // namespace
+
+PathGradient path_gradient(const PathDescriptor& path, double tolerance) noexcept
+{
+    PathGradient out;
+    out.path = path;
+
+    const auto types = segment_types(path.word);
+    const auto end   = end_state(path);
+    const auto r     = path.radius;
+
+    // Vector between the centers of the first and last turning circle
+    const auto n1 = center_offset(path.start.heading, types[0]);
+    const auto n2 = center_offset(end.heading, types[2]);
+    const auto v  = (end.position + r * n2) - (path.start.position + r * n1);
+
+    const auto d1 = r * center_rotation(path.start.heading, types[0]);
+    const auto d2 = r * center_rotation(end.heading, types[2]);
+
+    const auto local = local_gradients(path, v);
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+        const auto& g = local[k];
+        auto&       o = out.segments[k];
+        o[gradient_index::start_x]       = -g.center.x;
+        o[gradient_index::start_y]       = -g.center.y;
+        o[gradient_index::start_heading] = g.start_heading - inner(g.center, d1);
+        o[gradient_index::end_x]         = g.center.x;
+        o[gradient_index::end_y]         = g.center.y;
+        o[gradient_index::end_heading]   = g.end_heading + inner(g.center, d2);
+        o[gradient_index::radius]        = g.radius + inner(g.center, n2 - n1);
+        axpy(1.0, o, out.length);
+    }
+
+    out.near_switch = degenerate(path, v, tolerance);
+    return out;
+}
+
+PathGradient path_gradient(const State& start, const State& end, double radius, double tolerance) noexcept
+{
+    const auto from = turning_circles(start, radius);
+    const auto to   = turning_circles(end, radius);
+
+    // Same choice as shortest_path(), keeping the runner up
+    PathDescriptor best;
+    auto           best_length   = std::numeric_limits<double>::infinity();
+    auto           second_length = std::numeric_limits<double>::infinity();
+    for (const auto word : {Word::LSL, Word::RSR, Word::RSL, Word::LSR, Word::LRL, Word::RLR})
+    {
+        const auto path = word_path(from, to, word);
+        const auto len  = length(path);
+        if (len < best_length)
+        {
+            second_length = best_length;
+            best_length   = len;
+            best          = path;
+        }
+        else if (len < second_length)
+        {
+            second_length = len;
+        }
+    }
+
+    auto out = path_gradient(best, tolerance);
+    out.near_switch |= second_length - best_length < tolerance;
+    return out;
+}
+
+void path_gradients(const std::vector<State>& starts, const std::vector<State>& ends, double radius,
+                    std::vector<PathGradient>& out, double tolerance)
+{
+    const auto n = std::min(starts.size(), ends.size());
+    out.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = path_gradient(starts[i], ends[i], radius, tolerance);
+    }
+}
+
+PoseGradient pose_gradient(const PathGradient& path, double distance) noexcept
+{
+    const auto& p     = path.path;
+    const auto  types = segment_types(p.word);
+    const auto  total = length(p);
+
+    State                   state = p.start;
+    std::array<Gradient, 3> ds{unit(gradient_index::start_x), unit(gradient_index::start_y),
+                               unit(gradient_index::start_heading)};
+
+    // Distance into the current segment, and its derivative: the distance is fixed so it moves against the segments
+    // already travelled, unless it is clamped to the end
+    const auto clamped   = distance >= total;
+    auto       remaining = std::max(0.0, std::min(distance, total));
+    Gradient   offset{};
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+        const auto  full = clamped || (k < 2 && remaining >= p.segments[k]);
+        const auto  l    = full ? p.segments[k] : remaining;
+        auto        dl   = full ? path.segments[k] : offset;
+        advance_gradient(state, ds, types[k], p.radius, l, dl);
+        if (!full)
+        {
+            break;
+        }
+
+        remaining -= l;
+        axpy(-1.0, path.segments[k], offset);
+    }
+
+    PoseGradient out;
+    out.state   = state_at(p, distance);
+    out.x       = ds[0];
+    out.y       = ds[1];
+    out.heading = ds[2];
+    return out;
+}
+
+void pose_gradients(const PathGradient& path, const std::vector<double>& distances, std::vector<PoseGradient>& out)
+{
+    out.resize(distances.size());
+    for (std::size_t i = 0; i < distances.size(); ++i)
+    {
+        out[i] = pose_gradient(path, distances[i]);
+    }
+}
+
+}    // namespace dubins
@@ -0,0 +1,265 @@
+#include "dubins/HeadingOptimizer.hpp"
+#include "dubins/PathDescriptor.hpp"
+
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace dubins
+{
+namespace
+{
+struct Assignment
+{
+    std::vector<double> headings;
+    double              length{std::numeric_limits<double>::infinity()};
+};
+
+// Dynamic program over `levels` evenly spaced headings per point
+Assignment solve_discrete(const std::vector<Vector2D>& points, std::size_t levels, double radius,
+                          detail::WorkerPool& pool)
+{
+    const auto n    = points.size();
+    const auto step = 2.0 * M_PI / double(levels);
+
+    // Turning circles are shared by every query touching a point
+    std::vector<TurningCircles> circles(n * levels);
+    pool.parallel_for(n * levels, 0, [&](std::size_t begin, std::size_t end) {
+        for (auto idx = begin; idx < end; ++idx)
+        {
+            const State state{points[idx / levels], step * double(idx % levels)};
+            circles[idx] = turning_circles(state, radius);
+        }
+    });
+
+    std::vector<double>       cost(n * levels, 0.0);
+    std::vector<std::int32_t> parent(n * levels, -1);
+
+    for (std::size_t i = 1; i < n; ++i)
+    {
+        const auto* prev_cost    = &cost[(i - 1) * levels];
+        const auto* prev_circles = &circles[(i - 1) * levels];
+
+        // Each candidate heading at point i is independent
+        pool.parallel_for(levels, 0, [&](std::size_t begin, std::size_t end) {
+            for (auto b = begin; b < end; ++b)
+            {
+                const auto& to   = circles[i * levels + b];
+                double      best = std::numeric_limits<double>::infinity();
+                std::size_t arg  = 0;
+
+                for (std::size_t a = 0; a < levels; ++a)
+                {
+                    const auto c = prev_cost[a] + length(shortest_path(prev_circles[a], to));
+                    if (c < best)
+                    {
+                        best = c;
+                        arg  = a;
+                    }
+                }
+
+                cost[i * levels + b]   = best;
+                parent[i * levels + b] = static_cast<std::int32_t>(arg);
+            }
+        });
+    }
+
+    // Backtrack from the best final heading
+    const auto* last = &cost[(n - 1) * levels];
+    auto        arg  = static_cast<std::size_t>(std::min_element(last, last + levels) - last);
+
+    Assignment result;
+    result.length = last[arg];
+    result.headings.resize(n);
+    for (std::size_t i = n; i-- > 0;)
+    {
+        result.headings[i] = step * double(arg);
+        if (i > 0)
+        {
+            arg = static_cast<std::size_t>(parent[i * levels + arg]);
+        }
+    }
+
+    return result;
+}
+
+double leg_length(const std::vector<Vector2D>& points, const std::vector<double>& headings, std::size_t i,
+                  double radius) noexcept
+{
+    return length(shortest_path({points[i], headings[i]}, {points[i + 1], headings[i + 1]}, radius));
+}
+
+// Length of the legs touching point i when it has the given heading
+double local_length(const std::vector<Vector2D>& points, const std::vector<double>& headings, std::size_t i,
+                    double heading, double radius) noexcept
+{
+    double len = 0.0;
+    if (i > 0)
+    {
+        len += length(shortest_path({points[i - 1], headings[i - 1]}, {points[i], heading}, radius));
+    }
+    if (i + 1 < points.size())
+    {
+        len += length(shortest_path({points[i], heading}, {points[i + 1], headings[i + 1]}, radius));
+    }
+    return len;
+}
+
+// Golden section search for the heading of point i within +-width of its current value. Only improvements are kept.
+void refine_point(const std::vector<Vector2D>& points, std::vector<double>& headings, std::size_t i, double width,
+                  double radius) noexcept
+{
+    constexpr double inv_phi = 0.6180339887498949;
+
+    auto best_heading = headings[i];
+    auto best_length  = local_length(points, headings, i, best_heading, radius);
+
+    double lo = best_heading - width;
+    double hi = best_heading + width;
+    double x1 = hi - inv_phi * (hi - lo);
+    double x2 = lo + inv_phi * (hi - lo);
+    double f1 = local_length(points, headings, i, x1, radius);
+    double f2 = local_length(points, headings, i, x2, radius);
+
+    for (int iter = 0; iter < 40; ++iter)
+    {
+        if (f1 < f2)
+        {
+            hi = x2;
+            x2 = x1;
+            f2 = f1;
+            x1 = hi - inv_phi * (hi - lo);
+            f1 = local_length(points, headings, i, x1, radius);
+        }
+        else
+        {
+            lo = x1;
+            x1 = x2;
+            f1 = f2;
+            x2 = lo + inv_phi * (hi - lo);
+            f2 = local_length(points, headings, i, x2, radius);
+        }
+
+        const auto f = std::min(f1, f2);
+        if (f < best_length)
+        {
+            best_length  = f;
+            best_heading = f1 < f2 ? x1 : x2;
+        }
+    }
+
+    headings[i] = best_heading;
+}
+
+double route_length(const std::vector<Vector2D>& points, const std::vector<double>& headings, double radius)
+{
+    double len = 0.0;
+    for (std::size_t i = 0; i + 1 < points.size(); ++i)
+    {
+        len += leg_length(points, headings, i, radius);
+    }
+    return len;
+}
+
+}    // namespace
+
+HeadingOptimizer::HeadingOptimizer(const std::vector<Vector2D>& points, const Options& options) :
+    m_points{points}, m_headings(points.size(), 0.0)
+{
+    if (points.size() < 2)
+    {
+        return;
+    }
+
+    const auto radius     = options.turning_radius;
+    const auto max_levels = static_cast<std::size_t>(std::max(1, options.heading_levels));
+
+    // Every stage of every pass is split over the same threads, a route of hundreds of points has thousands of stages
+    detail::WorkerPool pool{options.threads};
+
+    // Discrete passes, doubling the number of candidate headings each time
+    Assignment best;
+    auto       levels = std::min(max_levels, static_cast<std::size_t>(std::max(1, options.min_heading_levels)));
+    while (true)
+    {
+        auto result = solve_discrete(points, levels, radius, pool);
+        m_levels.push_back({static_cast<std::int32_t>(levels), result.length});
+        if (result.length < best.length)
+        {
+            best = std::move(result);
+        }
+
+        if (levels >= max_levels)
+        {
+            break;
+        }
+        levels = std::min(2 * levels, max_levels);
+    }
+
+    m_headings = std::move(best.headings);
+    m_length   = best.length;
+
+    // Continuous refinement. A point's optimal heading only depends on its neighbours, so all even points and then all
+    // odd points can be refined in parallel.
+    auto width = 2.0 * M_PI / double(max_levels);
+    for (std::int32_t iter = 0; iter < options.refinement_iterations; ++iter)
+    {
+        for (std::size_t parity = 0; parity < 2; ++parity)
+        {
+            const auto count = (points.size() + 1 - parity) / 2;
+            pool.parallel_for(count, 0, [&](std::size_t begin, std::size_t end) {
+                for (auto j = begin; j < end; ++j)
+                {
+                    refine_point(points, m_headings, 2 * j + parity, width, radius);
+                }
+            });
+        }
+
+        const auto len         = route_length(points, m_headings, radius);
+        const auto improvement = m_length - len;
+        m_length               = std::min(m_length, len);
+        width *= 0.5;
+
+        if (improvement < options.refinement_tolerance)
+        {
+            break;
+        }
+    }
+
+    for (auto& heading : m_headings)
+    {
+        heading = std::remainder(heading, 2.0 * M_PI);
+    }
+}
+
+const std::vector<double>& HeadingOptimizer::headings() const noexcept
+{
+    return m_headings;
+}
+
+std::vector<State> HeadingOptimizer::states() const
+{
+    std::vector<State> states;
+    states.reserve(m_points.size());
+    for (std::size_t i = 0; i < m_points.size(); ++i)
+    {
+        states.push_back({m_points[i], m_headings[i]});
+    }
+    return states;
+}
+
+double HeadingOptimizer::length() const noexcept
+{
+    return m_length;
+}
+
+const std::vector<HeadingOptimizer::Level>& HeadingOptimizer::levels() const noexcept
+{
+    return m_levels;
+}
+
+}    // namespace dubins
@@ -0,0 +1,320 @@
+#include "dubins/HybridAStar.hpp"
+#include "dubins/Angle.hpp"
+#include "dubins/Bounds.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+
+namespace dubins
+{
+namespace
+{
+constexpr double infinity = std::numeric_limits<double>::infinity();
+
+// An 8-connected grid path is at most this much longer than the straight line between its ends
+constexpr double octile_stretch = 1.0823922002923940;
+
+struct Node
+{
+    State          state;
+    double         g{0.0};
+    std::int64_t   parent{-1};
+    PathDescriptor motion;    // Primitive from the parent
+};
+
+// Search state of a visited (x, y, heading) bin
+struct Bin
+{
+    std::int64_t best{-1};           // Node holding the bin
+    double       heuristic{-1.0};    // Cached heuristic, negative until computed
+    bool         closed{false};
+};
+
+PathDescriptor primitive(const State& from, SegmentType type, double radius, double step) noexcept
+{
+    PathDescriptor path;
+    path.start    = from;
+    path.radius   = radius;
+    path.word     = type == SegmentType::right ? Word::RSR : Word::LSL;
+    path.segments = type == SegmentType::straight ? std::array<double, 3>{0.0, step, 0.0}
+                                                  : std::array<double, 3>{step, 0.0, 0.0};
+    return path;
+}
+
+}    // namespace
+
+HybridAStar::HybridAStar(const Grid& grid, std::vector<std::uint8_t> occupancy, const Options& options)
+    : m_grid{grid}, m_occupancy{std::move(occupancy)}, m_options{options}
+{
+    const auto w = std::size_t(std::max(grid.width, 0));
+    const auto h = std::size_t(std::max(grid.height, 0));
+    m_occupancy.resize(w * h, 0);
+
+    if (m_options.step <= 0.0)
+    {
+        m_options.step = 1.01 * std::sqrt(2.0) * grid.resolution;
+    }
+    m_options.headings      = std::max(m_options.headings, 1);
+    m_options.shot_interval = std::max<std::size_t>(m_options.shot_interval, 1);
+
+    m_summed.assign((w + 1) * (h + 1), 0);
+    for (std::size_t y = 0; y < h; ++y)
+    {
+        for (std::size_t x = 0; x < w; ++x)
+        {
+            m_summed[(y + 1) * (w + 1) + x + 1] = (m_occupancy[y * w + x] != 0 ? 1u : 0u)
+                                                  + m_summed[y * (w + 1) + x + 1] + m_summed[(y + 1) * (w + 1) + x]
+                                                  - m_summed[y * (w + 1) + x];
+        }
+    }
+}
+
+std::optional<HybridAStarPlan> HybridAStar::plan(const State& start, const State& goal)
+{
+    m_statistics = {};
+
+    const auto start_key = key(start);
+    const auto goal_key  = key(goal);
+    if (!start_key || !goal_key)
+    {
+        return std::nullopt;
+    }
+
+    grid_distance(goal);
+
+    const auto r      = m_options.turning_radius;
+    const auto target = turning_circles(goal, r);
+    const auto bins   = std::size_t(m_options.headings);
+
+    // Only bins the search reaches are stored, a dense grid of headings would not fit large maps
+    std::vector<Node>                    nodes;
+    std::unordered_map<std::size_t, Bin> visited;
+    visited.reserve(
+        std::min(3 * m_options.max_expansions, std::size_t(m_grid.width) * std::size_t(m_grid.height) * bins));
+
+    // A free path is at least as long as the grid distance, up to the stretch of 8-connected moves and the offset of
+    // its start from the cell center
+    const auto grid_bound = [&](std::size_t k) {
+        return (m_distance[k / bins] - 2.0 * std::sqrt(2.0) * m_grid.resolution) / octile_stretch;
+    };
+
+    const auto h = [&](Bin& bin, std::size_t k, const State& state) {
+        if (bin.heuristic >= 0.0)
+        {
+            ++m_statistics.cached;
+            return bin.heuristic;
+        }
+        const auto dubins = length(shortest_path(turning_circles(state, r), target));
+        bin.heuristic     = std::max(dubins, grid_bound(k));
+        return bin.heuristic;
+    };
+
+    // Dubins shot from a node, filtered from cheap to expensive
+    const auto shoot = [&](const State& from, std::size_t k) -> std::optional<PathDescriptor> {
+        ++m_statistics.shots;
+        const auto shot = shortest_path(from, goal, r);
+        if (grid_bound(k) > length(shot))
+        {
+            ++m_statistics.rejected_early;
+            return std::nullopt;
+        }
+
+        const auto box = bounds(shot);
+        if (box_free(box.min, box.max))
+        {
+            ++m_statistics.accepted_broad;
+            return shot;
+        }
+
+        ++m_statistics.traversals;
+        return free(shot) ? std::optional<PathDescriptor>{shot} : std::nullopt;
+    };
+
+    using Entry = std::pair<double, std::int64_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+
+    nodes.push_back({start, 0.0, -1, {}});
+    auto& first = visited[*start_key];
+    first.best  = 0;
+    open.push({h(first, *start_key, start), 0});
+
+    while (!open.empty() && m_statistics.expansions < m_options.max_expansions)
+    {
+        const auto index = open.top().second;
+        open.pop();
+
+        const auto node = nodes[std::size_t(index)];
+        const auto k    = *key(node.state);
+        auto&      bin  = visited[k];
+        if (bin.closed || bin.best != index)
+        {
+            continue;
+        }
+        bin.closed = true;
+        ++m_statistics.expansions;
+
+        const auto cadence = (m_statistics.expansions - 1) % m_options.shot_interval == 0;
+        if (cadence || h(bin, k, node.state) <= m_options.shot_distance)
+        {
+            if (const auto shot = shoot(node.state, k))
+            {
+                HybridAStarPlan plan;
+                plan.segments.push_back(*shot);
+                for (auto i = index; nodes[std::size_t(i)].parent >= 0; i = nodes[std::size_t(i)].parent)
+                {
+                    plan.segments.push_back(nodes[std::size_t(i)].motion);
+                }
+                std::reverse(plan.segments.begin(), plan.segments.end());
+                plan.length = node.g + length(*shot);
+                return plan;
+            }
+        }
+
+        for (const auto type : {SegmentType::left, SegmentType::straight, SegmentType::right})
+        {
+            const auto motion = primitive(node.state, type, r, m_options.step);
+            const auto end    = end_state(motion);
+            const auto child  = key(end);
+            if (!child)
+            {
+                continue;
+            }
+
+            const auto found = visited.find(*child);
+            if ((found != visited.end() && found->second.closed) || !free(motion))
+            {
+                continue;
+            }
+
+            auto&      slot = found != visited.end() ? found->second : visited[*child];
+            const auto g    = node.g + m_options.step;
+            if (slot.best >= 0 && nodes[std::size_t(slot.best)].g <= g)
+            {
+                continue;
+            }
+
+            const auto estimate = h(slot, *child, end);
+            if (std::isinf(estimate))
+            {
+                continue;
+            }
+
+            slot.best = static_cast<std::int64_t>(nodes.size());
+            nodes.push_back({end, g, index, motion});
+            open.push({g + estimate, slot.best});
+        }
+    }
+
+    return std::nullopt;
+}
+
+const HybridAStarStatistics& HybridAStar::statistics() const noexcept
+{
+    return m_statistics;
+}
+
+bool HybridAStar::free(const PathDescriptor& path) const
+{
+    const auto box = bounds(path);
+    const auto max = m_grid.origin + m_grid.resolution * Vector2D{double(m_grid.width), double(m_grid.height)};
+    if (box.min.x < m_grid.origin.x || box.min.y < m_grid.origin.y || box.max.x >= max.x || box.max.y >= max.y)
+    {
+        return false;
+    }
+    return !first_occupied(path, m_grid, m_occupancy.data());
+}
+
+std::optional<std::size_t> HybridAStar::key(const State& state) const noexcept
+{
+    const auto local = (state.position - m_grid.origin) / m_grid.resolution;
+    if (!(local.x >= 0.0 && local.y >= 0.0 && local.x < double(m_grid.width) && local.y < double(m_grid.height)))
+    {
+        return std::nullopt;
+    }
+
+    const auto bins = m_options.headings;
+    const auto x    = static_cast<std::size_t>(local.x);
+    const auto y    = static_cast<std::size_t>(local.y);
+    const auto k    = static_cast<std::int32_t>(std::lround(double(Angle{state.heading}) * bins / (2.0 * M_PI))) % bins;
+    return (y * std::size_t(m_grid.width) + x) * std::size_t(bins) + std::size_t(k);
+}
+
+bool HybridAStar::box_free(const Vector2D& min, const Vector2D& max) const noexcept
+{
+    const auto lo = (min - m_grid.origin) / m_grid.resolution;
+    const auto hi = (max - m_grid.origin) / m_grid.resolution;
+    if (!(lo.x >= 0.0 && lo.y >= 0.0 && hi.x < double(m_grid.width) && hi.y < double(m_grid.height)))
+    {
+        return false;
+    }
+
+    const auto stride = std::size_t(m_grid.width) + 1;
+    const auto x0     = static_cast<std::size_t>(lo.x);
+    const auto y0     = static_cast<std::size_t>(lo.y);
+    const auto x1     = static_cast<std::size_t>(hi.x) + 1;
+    const auto y1     = static_cast<std::size_t>(hi.y) + 1;
+
+    const auto occupied = m_summed[y1 * stride + x1] - m_summed[y0 * stride + x1] - m_summed[y1 * stride + x0]
+                          + m_summed[y0 * stride + x0];
+    return occupied == 0;
+}
+
+void HybridAStar::grid_distance(const State& goal)
+{
+    // Dijkstra over the free cells from the goal, 8-connected
+    const auto w = std::size_t(m_grid.width);
+    const auto h = std::size_t(m_grid.height);
+    m_distance.assign(w * h, infinity);
+
+    const auto local = (goal.position - m_grid.origin) / m_grid.resolution;
+    const auto start = static_cast<std::size_t>(local.y) * w + static_cast<std::size_t>(local.x);
+
+    using Entry = std::pair<double, std::size_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+
+    m_distance[start] = 0.0;
+    open.push({0.0, start});
+    while (!open.empty())
+    {
+        const auto [d, cell] = open.top();
+        open.pop();
+        if (d > m_distance[cell])
+        {
+            continue;
+        }
+
+        const auto cx = static_cast<std::int64_t>(cell % w);
+        const auto cy = static_cast<std::int64_t>(cell / w);
+        for (std::int64_t dy = -1; dy <= 1; ++dy)
+        {
+            for (std::int64_t dx = -1; dx <= 1; ++dx)
+            {
+                const auto nx = cx + dx;
+                const auto ny = cy + dy;
+                if ((dx == 0 && dy == 0) || nx < 0 || ny < 0 || nx >= std::int64_t(w) || ny >= std::int64_t(h))
+                {
+                    continue;
+                }
+
+                const auto next = std::size_t(ny) * w + std::size_t(nx);
+                if (m_occupancy[next] != 0)
+                {
+                    continue;
+                }
+
+                const auto step = (dx != 0 && dy != 0 ? std::sqrt(2.0) : 1.0) * m_grid.resolution;
+                if (d + step < m_distance[next])
+                {
+                    m_distance[next] = d + step;
+                    open.push({d + step, next});
+                }
+            }
+        }
+    }
+}
+
+}    // namespace dubins
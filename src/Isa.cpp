@@ -0,0 +1,106 @@
+#include "dubins/Isa.hpp"
+
+#include "Dispatch.hpp"
+
+#include <atomic>
+#include <cstdlib>
+
+namespace dubins
+{
+namespace
+{
+Isa best_supported() noexcept
+{
+    for (const auto isa : {Isa::avx512, Isa::avx2})
+    {
+        if (isa_supported(isa))
+        {
+            return isa;
+        }
+    }
+    return Isa::generic;
+}
+
+// Chosen once when the library is loaded
+std::atomic<Isa> g_isa{default_isa()};
+
+}    // namespace
+
+bool isa_supported(Isa isa) noexcept
+{
+#if DUBINS_ISA_DISPATCH
+    // The CPU model is filled in by a static initializer of its own, which need not have run before g_isa's
+    __builtin_cpu_init();
+#endif
+
+    switch (isa)
+    {
+        case Isa::scalar:
+        case Isa::generic: return true;
+#if DUBINS_ISA_DISPATCH
+        case Isa::avx2: return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        case Isa::avx512:
+            return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")
+                   && __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512bw")
+                   && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+        case Isa::avx2:
+        case Isa::avx512: return false;
+#endif
+    }
+    return false;
+}
+
+bool set_isa(Isa isa) noexcept
+{
+    if (!isa_supported(isa))
+    {
+        return false;
+    }
+    g_isa.store(isa, std::memory_order_relaxed);
+    return true;
+}
+
+Isa isa() noexcept
+{
+    return g_isa.load(std::memory_order_relaxed);
+}
+
+Isa default_isa() noexcept
+{
+    if (const auto* name = std::getenv("DUBINS_ISA"))
+    {
+        const auto isa = isa_from_string(name);
+        if (isa && isa_supported(*isa))
+        {
+            return *isa;
+        }
+    }
+    return best_supported();
+}
+
+std::string_view to_string(Isa isa) noexcept
+{
+    switch (isa)
+    {
+        case Isa::scalar: return "scalar";
+        case Isa::generic: return "generic";
+        case Isa::avx2: return "avx2";
+        case Isa::avx512: return "avx512";
+    }
+    return "";
+}
+
+std::optional<Isa> isa_from_string(std::string_view name) noexcept
+{
+    for (const auto isa : {Isa::scalar, Isa::generic, Isa::avx2, Isa::avx512})
+    {
+        if (name == to_string(isa))
+        {
+            return isa;
+        }
+    }
+    return std::nullopt;
+}
+
+}    // namespace dubins
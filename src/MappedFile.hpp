@@ -0,0 +1,167 @@
+#ifndef DUBINS_MAPPED_FILE_HPP
+#define DUBINS_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define DUBINS_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace dubins
+{
+namespace detail
+{
+/// @brief Read-only view of a whole file
+struct FileView
+{
+    std::shared_ptr<const std::uint8_t> data;       ///< File contents, stays valid while any copy of the pointer lives
+    std::size_t                         size{0};    ///< Number of bytes
+};
+
+/// @brief Map a file into memory read-only. Falls back to reading the file where mmap is not available.
+/// @param filename file to map
+/// @return view of the file, with a null data pointer on failure
+inline FileView map_file(const std::string& filename)
+{
+    FileView view;
+
+#ifdef DUBINS_HAS_MMAP
+    const auto fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return view;
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size <= 0)
+    {
+        ::close(fd);
+        return view;
+    }
+
+    const auto size   = static_cast<std::size_t>(info.st_size);
+    auto*      memory = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (memory == MAP_FAILED)
+    {
+        return view;
+    }
+
+    view.size = size;
+    view.data = std::shared_ptr<const std::uint8_t>(static_cast<const std::uint8_t*>(memory),
+                                                    [size](const std::uint8_t* p) {
+                                                        ::munmap(const_cast<std::uint8_t*>(p), size);
+                                                    });
+#else
+    std::ifstream file{filename, std::ios::binary};
+    if (file.good() == false)
+    {
+        return view;
+    }
+
+    auto buffer = std::make_shared<std::vector<std::uint8_t>>(std::istreambuf_iterator<char>(file),
+                                                              std::istreambuf_iterator<char>());
+    view.size   = buffer->size();
+    view.data   = std::shared_ptr<const std::uint8_t>(buffer, buffer->data());
+#endif
+
+    return view;
+}
+
+/// @brief Writable view of a whole file
+struct MutableFileView
+{
+    std::shared_ptr<std::uint8_t> data;       ///< File contents, written back by the time the last copy is released
+    std::size_t                   size{0};    ///< Number of bytes
+};
+
+/// @brief Map a file into memory read-write, creating it and resizing it to a given size. Existing contents within the
+/// size are kept. Falls back to reading the file into a buffer that is written back on release where mmap is not
+/// available.
+/// @param filename file to map
+/// @param size size of the file in bytes
+/// @return view of the file, with a null data pointer on failure
+inline MutableFileView map_file_writable(const std::string& filename, std::size_t size)
+{
+    MutableFileView view;
+    if (size == 0)
+    {
+        return view;
+    }
+
+#ifdef DUBINS_HAS_MMAP
+    const auto fd = ::open(filename.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+    {
+        return view;
+    }
+
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+    {
+        ::close(fd);
+        return view;
+    }
+
+    auto* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (memory == MAP_FAILED)
+    {
+        return view;
+    }
+
+    view.size = size;
+    view.data = std::shared_ptr<std::uint8_t>(static_cast<std::uint8_t*>(memory),
+                                              [size](std::uint8_t* p) { ::munmap(p, size); });
+#else
+    std::vector<std::uint8_t> contents;
+    {
+        std::ifstream file{filename, std::ios::binary};
+        contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    contents.resize(size);
+
+    auto buffer = std::make_shared<std::vector<std::uint8_t>>(std::move(contents));
+    view.size   = size;
+    view.data   = std::shared_ptr<std::uint8_t>(buffer->data(), [buffer, filename](std::uint8_t*) {
+        std::ofstream file{filename, std::ios::binary | std::ios::trunc};
+        file.write(reinterpret_cast<const char*>(buffer->data()), std::streamsize(buffer->size()));
+    });
+#endif
+
+    return view;
+}
+
+/// @brief Write a range of a writable view through to the file and wait for it to complete. Without mmap the range is
+/// only written back on release.
+/// @param view writable view
+/// @param offset first byte of the range
+/// @param size number of bytes in the range
+/// @return true on success
+inline bool flush(const MutableFileView& view, std::size_t offset, std::size_t size)
+{
+#ifdef DUBINS_HAS_MMAP
+    // msync needs a page aligned start
+    const auto page  = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    const auto begin = offset / page * page;
+    return ::msync(view.data.get() + begin, offset + size - begin, MS_SYNC) == 0;
+#else
+    return view.data != nullptr && offset + size <= view.size;
+#endif
+}
+
+}    // namespace detail
+}    // namespace dubins
+
+#endif    // DUBINS_MAPPED_FILE_HPP
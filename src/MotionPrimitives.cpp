@@ -0,0 +1,315 @@
+#include "dubins/MotionPrimitives.hpp"
+
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace dubins
+{
+namespace
+{
+// End pose of a primitive, the start is always the origin
+struct Pose
+{
+    std::int32_t start_heading;
+    std::int32_t dx;
+    std::int32_t dy;
+    std::int32_t end_heading;
+};
+
+bool operator<(const Pose& lhs, const Pose& rhs) noexcept
+{
+    return std::tie(lhs.start_heading, lhs.dy, lhs.dx, lhs.end_heading)
+           < std::tie(rhs.start_heading, rhs.dy, rhs.dx, rhs.end_heading);
+}
+
+bool operator==(const Pose& lhs, const Pose& rhs) noexcept
+{
+    return std::tie(lhs.start_heading, lhs.dx, lhs.dy, lhs.end_heading)
+           == std::tie(rhs.start_heading, rhs.dx, rhs.dy, rhs.end_heading);
+}
+
+// Lattice symmetry: an optional reflection about the x axis followed by a number of quarter turns
+struct Symmetry
+{
+    std::int32_t quarter_turns{0};
+    bool         reflect{false};
+};
+
+std::vector<Symmetry> symmetries(std::int32_t headings)
+{
+    // Quarter turns only map heading indices onto heading indices when the headings split evenly into quadrants
+    const std::int32_t turns = headings % 4 == 0 ? 4 : 1;
+
+    std::vector<Symmetry> result;
+    for (const auto reflect : {false, true})
+    {
+        for (std::int32_t t = 0; t < turns; ++t)
+        {
+            result.push_back({t, reflect});
+        }
+    }
+    return result;
+}
+
+std::int32_t wrap_index(std::int32_t k, std::int32_t headings) noexcept
+{
+    return ((k % headings) + headings) % headings;
+}
+
+template<typename T>
+void apply(const Symmetry& sym, T& x, T& y) noexcept
+{
+    if (sym.reflect)
+    {
+        y = -y;
+    }
+    for (std::int32_t t = 0; t < sym.quarter_turns; ++t)
+    {
+        const auto old_x = x;
+        x                = -y;
+        y                = old_x;
+    }
+}
+
+std::int32_t apply_heading(const Symmetry& sym, std::int32_t k, std::int32_t headings) noexcept
+{
+    const auto reflected = sym.reflect ? -k : k;
+    return wrap_index(reflected + sym.quarter_turns * headings / 4, headings);
+}
+
+Pose apply(const Symmetry& sym, Pose pose, std::int32_t headings) noexcept
+{
+    apply(sym, pose.dx, pose.dy);
+    pose.start_heading = apply_heading(sym, pose.start_heading, headings);
+    pose.end_heading   = apply_heading(sym, pose.end_heading, headings);
+    return pose;
+}
+
+Word apply(const Symmetry& sym, Word word) noexcept
+{
+    if (sym.reflect == false)
+    {
+        return word;
+    }
+
+    // Mirroring swaps left and right turns
+    switch (word)
+    {
+        case Word::LSL: return Word::RSR;
+        case Word::RSR: return Word::LSL;
+        case Word::RSL: return Word::LSR;
+        case Word::LSR: return Word::RSL;
+        case Word::LRL: return Word::RLR;
+        case Word::RLR: return Word::LRL;
+    }
+    return word;
+}
+
+BoundingBox apply(const Symmetry& sym, const BoundingBox& box) noexcept
+{
+    // Quarter turns and reflections map a box onto a box, so two opposite corners are enough
+    auto a = box.min;
+    auto b = box.max;
+    apply(sym, a.x, a.y);
+    apply(sym, b.x, b.y);
+
+    BoundingBox result;
+    expand(result, a);
+    expand(result, b);
+    return result;
+}
+
+struct Solution
+{
+    PathDescriptor    path;
+    BoundingBox       bounds;
+    std::vector<Cell> cells;
+};
+
+Solution solve(const Pose& pose, const MotionPrimitiveTable::Options& options)
+{
+    const auto step = 2.0 * M_PI / double(options.headings);
+
+    const State start{{0.0, 0.0}, step * pose.start_heading};
+    const State end{options.resolution * Vector2D{double(pose.dx), double(pose.dy)}, step * pose.end_heading};
+
+    Solution solution;
+    solution.path   = shortest_path(start, end, options.turning_radius);
+    solution.bounds = bounds(solution.path);
+
+    if (options.swept_cells)
+    {
+        // Grid of cells centered on the lattice nodes, large enough to hold the whole path
+        const auto extent = std::max({std::abs(solution.bounds.min.x), std::abs(solution.bounds.min.y),
+                                      std::abs(solution.bounds.max.x), std::abs(solution.bounds.max.y)});
+        const auto n      = static_cast<std::int32_t>(std::ceil(extent / options.resolution + 0.5)) + 1;
+
+        Grid grid;
+        grid.resolution = options.resolution;
+        grid.origin     = -(double(n) + 0.5) * options.resolution * Vector2D{1.0, 1.0};
+        grid.width      = 2 * n + 1;
+        grid.height     = 2 * n + 1;
+
+        solution.cells = rasterize(solution.path, grid);
+        for (auto& cell : solution.cells)
+        {
+            cell.x -= n;
+            cell.y -= n;
+        }
+    }
+
+    return solution;
+}
+
+}    // namespace
+
+MotionPrimitiveTable::MotionPrimitiveTable(const Options& options) : m_options{options}
+{
+    m_heading_offsets.assign(std::size_t(std::max(options.headings, 0)) + 1, 0);
+    if (options.headings <= 0 || options.range < 0)
+    {
+        return;
+    }
+
+    const auto group = symmetries(options.headings);
+
+    // Every pose of the neighbourhood and the canonical (smallest) member of its symmetry class
+    std::vector<std::pair<Pose, Pose>> poses;
+    std::map<Pose, std::size_t>        unique;
+    for (std::int32_t k = 0; k < options.headings; ++k)
+    {
+        for (std::int32_t dy = -options.range; dy <= options.range; ++dy)
+        {
+            for (std::int32_t dx = -options.range; dx <= options.range; ++dx)
+            {
+                for (std::int32_t e = 0; e < options.headings; ++e)
+                {
+                    if (dx == 0 && dy == 0 && e == k)
+                    {
+                        continue;
+                    }
+
+                    const Pose pose{k, dx, dy, e};
+                    auto       canonical = pose;
+                    for (const auto& sym : group)
+                    {
+                        canonical = std::min(canonical, apply(sym, pose, options.headings));
+                    }
+
+                    poses.emplace_back(pose, canonical);
+                    unique.emplace(canonical, 0);
+                }
+            }
+        }
+    }
+
+    // Solve one representative per class
+    std::vector<Pose> representatives;
+    representatives.reserve(unique.size());
+    for (auto& [pose, idx] : unique)
+    {
+        idx = representatives.size();
+        representatives.push_back(pose);
+    }
+
+    std::vector<Solution> solutions(representatives.size());
+    detail::parallel_for(representatives.size(), options.threads, [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i)
+        {
+            solutions[i] = solve(representatives[i], options);
+        }
+    });
+    m_solved = solutions.size();
+
+    // Map the representatives onto every pose, poses are already ordered by start heading
+    for (const auto& [pose, canonical] : poses)
+    {
+        const auto& solution = solutions[unique[canonical]];
+        if (length(solution.path) > options.max_length)
+        {
+            continue;
+        }
+
+        Symmetry sym;
+        for (const auto& candidate : group)
+        {
+            if (apply(candidate, canonical, options.headings) == pose)
+            {
+                sym = candidate;
+                break;
+            }
+        }
+
+        MotionPrimitive primitive;
+        primitive.start_heading = pose.start_heading;
+        primitive.dx            = pose.dx;
+        primitive.dy            = pose.dy;
+        primitive.end_heading   = pose.end_heading;
+        primitive.length        = length(solution.path);
+        primitive.segments      = solution.path.segments;
+        primitive.word          = apply(sym, solution.path.word);
+        primitive.bounds        = apply(sym, solution.bounds);
+        primitive.cells_begin   = static_cast<std::uint32_t>(m_cells.size());
+        primitive.cells_count   = static_cast<std::uint32_t>(solution.cells.size());
+
+        for (auto cell : solution.cells)
+        {
+            apply(sym, cell.x, cell.y);
+            m_cells.push_back(cell);
+        }
+
+        m_primitives.push_back(primitive);
+        ++m_heading_offsets[std::size_t(pose.start_heading) + 1];
+    }
+
+    for (std::size_t k = 1; k < m_heading_offsets.size(); ++k)
+    {
+        m_heading_offsets[k] += m_heading_offsets[k - 1];
+    }
+}
+
+const std::vector<MotionPrimitive>& MotionPrimitiveTable::primitives() const noexcept
+{
+    return m_primitives;
+}
+
+std::pair<const MotionPrimitive*, const MotionPrimitive*>
+MotionPrimitiveTable::from_heading(std::int32_t start_heading) const noexcept
+{
+    const auto* data = m_primitives.data();
+    return {data + m_heading_offsets[std::size_t(start_heading)],
+            data + m_heading_offsets[std::size_t(start_heading) + 1]};
+}
+
+std::pair<const Cell*, const Cell*> MotionPrimitiveTable::cells(const MotionPrimitive& primitive) const noexcept
+{
+    const auto* data = m_cells.data();
+    return {data + primitive.cells_begin, data + primitive.cells_begin + primitive.cells_count};
+}
+
+PathDescriptor MotionPrimitiveTable::path(const MotionPrimitive& primitive) const noexcept
+{
+    PathDescriptor path;
+    path.start    = {{0.0, 0.0}, 2.0 * M_PI * double(primitive.start_heading) / double(m_options.headings)};
+    path.radius   = m_options.turning_radius;
+    path.segments = primitive.segments;
+    path.word     = primitive.word;
+    return path;
+}
+
+std::size_t MotionPrimitiveTable::solved_count() const noexcept
+{
+    return m_solved;
+}
+
+const MotionPrimitiveTable::Options& MotionPrimitiveTable::options() const noexcept
+{
+    return m_options;
+}
+
+}    // namespace dubins
@@ -0,0 +1,329 @@
+#include "dubins/OneToMany.hpp"
+#include "dubins/Angle.hpp"
+#include "dubins/Trig.hpp"
+
+#include "Dispatch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace dubins
+{
+namespace
+{
+constexpr double infinity = std::numeric_limits<double>::infinity();
+constexpr double two_pi   = 2.0 * M_PI;
+
+struct ExactTrig
+{
+    static double atan2(double y, double x) noexcept { return std::atan2(y, x); }
+    static void   sincos(double angle, double& s, double& c) noexcept
+    {
+        s = std::sin(angle);
+        c = std::cos(angle);
+    }
+};
+
+struct ApproximateTrig
+{
+    static double atan2(double y, double x) noexcept { return approx_atan2(y, x); }
+    static void   sincos(double angle, double& s, double& c) noexcept { approx_sincos(angle, s, c); }
+};
+
+// Wrap to [0, 2pi) without branches
+DUBINS_KERNEL double mod_two_pi(double angle) noexcept
+{
+    return angle - two_pi * detail::floor(angle * (1.0 / two_pi));
+}
+
+// Shortest path to a goal in the normalized frame of the start: start at the origin heading along +x, turning radius
+// 1, so the start's left and right turning circles are centered at (0, 1) and (0, -1).
+struct Solution
+{
+    double       length{infinity};
+    double       segments[3]{infinity, 0.0, 0.0};
+    std::uint8_t word{0};
+};
+
+DUBINS_KERNEL void keep_shorter(Solution& best, double t, double p, double q, bool feasible, Word word) noexcept
+{
+    const auto len    = feasible ? t + p + q : infinity;
+    const auto better = len < best.length;
+
+    best.length      = better ? len : best.length;
+    best.segments[0] = better ? t : best.segments[0];
+    best.segments[1] = better ? p : best.segments[1];
+    best.segments[2] = better ? q : best.segments[2];
+    best.word        = better ? static_cast<std::uint8_t>(word) : best.word;
+}
+
+template<typename Trig>
+DUBINS_KERNEL Solution solve_normalized(double x, double y, double heading) noexcept
+{
+    double s, c;
+    Trig::sincos(heading, s, c);
+
+    // Goal turning circle centers
+    const auto left_x  = x - s;
+    const auto left_y  = y + c;
+    const auto right_x = x + s;
+    const auto right_y = y - c;
+
+    Solution best;
+
+    // Circles of the same direction: outer tangents and transfer circles
+    {
+        // Left to left
+        const auto vx  = left_x;
+        const auto vy  = left_y - 1.0;
+        const auto d2  = vx * vx + vy * vy;
+        const auto d   = std::sqrt(d2);
+        const auto phi = Trig::atan2(vy, vx);
+
+        keep_shorter(best, mod_two_pi(phi), d, mod_two_pi(heading - phi), true, Word::LSL);
+
+        // The transfer circle meets both outer circles at angle acos(d / 4) from the line between them. Transfer
+        // circles are only used for d^2 <= 12, matching calculate_transfer_circle.
+        const auto gamma = Trig::atan2(std::sqrt(std::max(0.0, 16.0 - d2)), d);
+        keep_shorter(best, mod_two_pi(phi + gamma + M_PI_2), M_PI + 2.0 * gamma,
+                     mod_two_pi(heading - phi + gamma - 1.5 * M_PI), (d2 > 0.0) & (d2 <= 12.0), Word::LRL);
+    }
+    {
+        // Right to right
+        const auto vx  = right_x;
+        const auto vy  = right_y + 1.0;
+        const auto d2  = vx * vx + vy * vy;
+        const auto d   = std::sqrt(d2);
+        const auto phi = Trig::atan2(vy, vx);
+
+        keep_shorter(best, mod_two_pi(-phi), d, mod_two_pi(phi - heading), true, Word::RSR);
+
+        const auto gamma = Trig::atan2(std::sqrt(std::max(0.0, 16.0 - d2)), d);
+        keep_shorter(best, mod_two_pi(M_PI_2 - phi + gamma), M_PI + 2.0 * gamma,
+                     mod_two_pi(phi + gamma - heading + M_PI_2), (d2 > 0.0) & (d2 <= 12.0), Word::RLR);
+    }
+
+    // Circles of opposite direction: inner tangents, which exist while the centers are at least 2 apart. The
+    // tolerance matches calculate_transfer_line.
+    {
+        // Left to right, the line heading is rotated left of the center line by atan2(2, p)
+        const auto vx  = right_x;
+        const auto vy  = right_y - 1.0;
+        const auto d2  = vx * vx + vy * vy;
+        const auto p   = std::sqrt(std::max(0.0, d2 - 4.0));
+        const auto psi = Trig::atan2(vy, vx) + Trig::atan2(2.0, p);
+
+        keep_shorter(best, mod_two_pi(psi), p, mod_two_pi(psi - heading), d2 * (1.0 + 1e-12) >= 4.0,
+                     Word::LSR);
+    }
+    {
+        // Right to left, the line heading is rotated right of the center line
+        const auto vx  = left_x;
+        const auto vy  = left_y + 1.0;
+        const auto d2  = vx * vx + vy * vy;
+        const auto p   = std::sqrt(std::max(0.0, d2 - 4.0));
+        const auto psi = Trig::atan2(vy, vx) - Trig::atan2(2.0, p);
+
+        keep_shorter(best, mod_two_pi(-psi), p, mod_two_pi(heading - psi), d2 * (1.0 + 1e-12) >= 4.0,
+                     Word::RSL);
+    }
+
+    return best;
+}
+
+// Goals in the normalized start frame, as a structure of arrays
+struct LocalGoals
+{
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> heading;
+};
+
+LocalGoals to_local(const State& start, const std::vector<State>& goals, double radius)
+{
+    const auto u   = unit_vector(start.heading);
+    const auto inv = 1.0 / radius;
+
+    LocalGoals local;
+    local.x.resize(goals.size());
+    local.y.resize(goals.size());
+    local.heading.resize(goals.size());
+
+    for (std::size_t i = 0; i < goals.size(); ++i)
+    {
+        const auto d     = goals[i].position - start.position;
+        local.x[i]       = (u.x * d.x + u.y * d.y) * inv;
+        local.y[i]       = (u.x * d.y - u.y * d.x) * inv;
+        local.heading[i] = goals[i].heading - start.heading;
+    }
+
+    return local;
+}
+
+// Solvers for the loops over goals: inlined so the loops can vectorize, or called one goal at a time. Under GCC -O3 with
+// the flags from src/CMakeLists.txt only the lengths loop with approximate trig vectorizes, for every instruction set.
+// Exact trig calls into libm and the paths loop stores whole descriptors.
+template<typename Trig>
+struct Vectorized
+{
+    static DUBINS_KERNEL Solution solve(double x, double y, double heading) noexcept
+    {
+        return solve_normalized<Trig>(x, y, heading);
+    }
+};
+
+template<typename Trig>
+struct Scalar
+{
+    static DUBINS_NO_INLINE Solution solve(double x, double y, double heading) noexcept
+    {
+        return solve_normalized<Trig>(x, y, heading);
+    }
+};
+
+template<typename Solver>
+DUBINS_KERNEL void lengths(const LocalGoals& local, double radius, double* out) noexcept
+{
+    const auto  n = local.x.size();
+    const auto* x = local.x.data();
+    const auto* y = local.y.data();
+    const auto* h = local.heading.data();
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = radius * Solver::solve(x[i], y[i], h[i]).length;
+    }
+}
+
+template<typename Solver>
+DUBINS_KERNEL void paths(const State& start, const LocalGoals& local, double radius, PathDescriptor* out) noexcept
+{
+    for (std::size_t i = 0; i < local.x.size(); ++i)
+    {
+        const auto solution = Solver::solve(local.x[i], local.y[i], local.heading[i]);
+
+        out[i].start    = start;
+        out[i].radius   = radius;
+        out[i].word     = static_cast<Word>(solution.word);
+        out[i].segments = {radius * solution.segments[0], radius * solution.segments[1],
+                           radius * solution.segments[2]};
+    }
+}
+
+template<typename Trig>
+struct LengthsKernel
+{
+    static DUBINS_KERNEL void run(const LocalGoals& local, double radius, double* out) noexcept
+    {
+        lengths<Vectorized<Trig>>(local, radius, out);
+    }
+    static void scalar(const LocalGoals& local, double radius, double* out) noexcept
+    {
+        lengths<Scalar<Trig>>(local, radius, out);
+    }
+};
+
+template<typename Trig>
+struct PathsKernel
+{
+    static DUBINS_KERNEL void run(const State& start, const LocalGoals& local, double radius,
+                                  PathDescriptor* out) noexcept
+    {
+        paths<Vectorized<Trig>>(start, local, radius, out);
+    }
+    static void scalar(const State& start, const LocalGoals& local, double radius, PathDescriptor* out) noexcept
+    {
+        paths<Scalar<Trig>>(start, local, radius, out);
+    }
+};
+
+State reversed(const State& state) noexcept
+{
+    return {state.position, state.heading + M_PI};
+}
+
+// Word of a path driven backwards: the segment order is reversed and left and right turns swap
+Word reversed(Word word) noexcept
+{
+    switch (word)
+    {
+        case Word::LSL: return Word::RSR;
+        case Word::RSR: return Word::LSL;
+        case Word::RSL: return Word::RSL;
+        case Word::LSR: return Word::LSR;
+        case Word::LRL: return Word::RLR;
+        case Word::RLR: return Word::LRL;
+    }
+    return word;
+}
+
+}    // namespace
+
+void one_to_many(const State& start, const std::vector<State>& goals, double radius, std::vector<double>& out)
+{
+    const auto local = to_local(start, goals, radius);
+
+    out.resize(goals.size());
+    if (trig_mode() == TrigMode::approximate)
+    {
+        detail::dispatch<LengthsKernel<ApproximateTrig>>(local, radius, out.data());
+    }
+    else
+    {
+        detail::dispatch<LengthsKernel<ExactTrig>>(local, radius, out.data());
+    }
+}
+
+void one_to_many(const State& start, const std::vector<State>& goals, double radius,
+                 std::vector<PathDescriptor>& out)
+{
+    const auto local = to_local(start, goals, radius);
+
+    out.resize(goals.size());
+    if (trig_mode() == TrigMode::approximate)
+    {
+        detail::dispatch<PathsKernel<ApproximateTrig>>(start, local, radius, out.data());
+    }
+    else
+    {
+        detail::dispatch<PathsKernel<ExactTrig>>(start, local, radius, out.data());
+    }
+}
+
+void many_to_one(const std::vector<State>& starts, const State& goal, double radius, std::vector<double>& out)
+{
+    std::vector<State> goals;
+    goals.reserve(starts.size());
+    for (const auto& start : starts)
+    {
+        goals.push_back(reversed(start));
+    }
+
+    one_to_many(reversed(goal), goals, radius, out);
+}
+
+void many_to_one(const std::vector<State>& starts, const State& goal, double radius,
+                 std::vector<PathDescriptor>& out)
+{
+    std::vector<State> goals;
+    goals.reserve(starts.size());
+    for (const auto& start : starts)
+    {
+        goals.push_back(reversed(start));
+    }
+
+    one_to_many(reversed(goal), goals, radius, out);
+
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        auto& path    = out[i];
+        path.start    = starts[i];
+        path.word     = reversed(path.word);
+        path.segments = {path.segments[2], path.segments[1], path.segments[0]};
+    }
+}
+
+}    // namespace dubins
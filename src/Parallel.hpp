@@ -0,0 +1,198 @@
+#ifndef DUBINS_PARALLEL_HPP
+#define DUBINS_PARALLEL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dubins
+{
+namespace detail
+{
+/// @brief Get the number of worker threads to use
+/// @param requested requested number of threads, 0 for one per hardware thread
+/// @return number of threads, at least 1
+inline std::size_t thread_count(std::size_t requested) noexcept
+{
+    if (requested > 0)
+    {
+        return requested;
+    }
+    return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+/// @brief Split [0, count) into contiguous chunks and run fn(begin, end) for each chunk on its own thread. The
+/// calling thread runs the first chunk itself.
+/// @param count number of items
+/// @param threads number of threads, 0 for one per hardware thread
+/// @param fn callable taking (std::size_t begin, std::size_t end)
+template<typename Fn>
+void parallel_for(std::size_t count, std::size_t threads, Fn&& fn)
+{
+    const auto num_threads = std::min(thread_count(threads), std::max<std::size_t>(count, 1));
+    if (num_threads <= 1)
+    {
+        fn(std::size_t{0}, count);
+        return;
+    }
+
+    const auto chunk = (count + num_threads - 1) / num_threads;
+
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads - 1);
+    for (std::size_t t = 1; t < num_threads; ++t)
+    {
+        const auto begin = std::min(count, t * chunk);
+        const auto end   = std::min(count, begin + chunk);
+        workers.emplace_back([&fn, begin, end]() { fn(begin, end); });
+    }
+
+    fn(std::size_t{0}, std::min(count, chunk));
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/// @brief Threads kept alive between parallel_for() calls, for callers that split many small jobs and can not afford
+/// to start threads for each. Only one thread may call parallel_for() at a time.
+class WorkerPool
+{
+    public:
+    /// @brief Start the workers
+    /// @param threads number of threads including the calling one, 0 for one per hardware thread
+    explicit WorkerPool(std::size_t threads)
+    {
+        const auto count = thread_count(threads);
+        m_workers.reserve(count - 1);
+        for (std::size_t t = 1; t < count; ++t)
+        {
+            m_workers.emplace_back([this, t]() { work(t); });
+        }
+    }
+
+    /// @brief Stop the workers, see stop()
+    ~WorkerPool() { stop(); }
+
+    WorkerPool(const WorkerPool&)            = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /// @brief Join the workers, parallel_for() then runs everything on the calling thread
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_stopping = true;
+        }
+        m_start.notify_all();
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+        m_workers.clear();
+    }
+
+    /// @brief Split [0, count) like the free parallel_for() and run the chunks on the workers. The calling thread runs
+    /// the first chunk itself.
+    /// @param count number of items
+    /// @param threads number of threads, 0 for every thread of the pool
+    /// @param fn callable taking (std::size_t begin, std::size_t end)
+    template<typename Fn>
+    void parallel_for(std::size_t count, std::size_t threads, Fn&& fn)
+    {
+        const auto num_threads = std::min({threads > 0 ? threads : m_workers.size() + 1, m_workers.size() + 1,
+                                           std::max<std::size_t>(count, 1)});
+        if (num_threads <= 1)
+        {
+            fn(std::size_t{0}, count);
+            return;
+        }
+
+        const auto chunk = (count + num_threads - 1) / num_threads;
+        const auto job   = std::function<void(std::size_t, std::size_t)>{
+            [&fn](std::size_t begin, std::size_t end) { fn(begin, end); }};
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_job       = &job;
+            m_count     = count;
+            m_chunk     = chunk;
+            m_active    = num_threads;
+            m_remaining = num_threads - 1;
+            ++m_generation;
+        }
+        m_start.notify_all();
+
+        // The workers hold on to the job until they are done, even if the first chunk throws
+        try
+        {
+            fn(std::size_t{0}, std::min(count, chunk));
+        }
+        catch (...)
+        {
+            wait();
+            throw;
+        }
+        wait();
+    }
+
+    private:
+    void work(std::size_t t)
+    {
+        std::uint64_t                seen = 0;
+        std::unique_lock<std::mutex> lock{m_mutex};
+        while (true)
+        {
+            m_start.wait(lock, [&]() { return m_stopping || m_generation != seen; });
+            if (m_stopping)
+            {
+                return;
+            }
+            seen = m_generation;
+            if (t >= m_active)
+            {
+                continue;
+            }
+
+            const auto begin = std::min(m_count, t * m_chunk);
+            const auto end   = std::min(m_count, begin + m_chunk);
+            const auto job   = m_job;
+            lock.unlock();
+            (*job)(begin, end);
+            lock.lock();
+
+            if (--m_remaining == 0)
+            {
+                m_done.notify_one();
+            }
+        }
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_done.wait(lock, [this]() { return m_remaining == 0; });
+    }
+
+    std::vector<std::thread>                             m_workers;
+    std::mutex                                           m_mutex;
+    std::condition_variable                              m_start;              ///< A job was posted or the pool stops
+    std::condition_variable                              m_done;               ///< The last worker finished its chunk
+    const std::function<void(std::size_t, std::size_t)>* m_job{nullptr};
+    std::size_t                                          m_count{0};
+    std::size_t                                          m_chunk{0};
+    std::size_t                                          m_active{0};          ///< Threads in the job, caller included
+    std::size_t                                          m_remaining{0};       ///< Workers still running their chunk
+    std::uint64_t                                        m_generation{0};      ///< Incremented for every job
+    bool                                                 m_stopping{false};
+};
+
+}    // namespace detail
+}    // namespace dubins
+
+#endif    // DUBINS_PARALLEL_HPP
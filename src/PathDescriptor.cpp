@@ -0,0 +1,241 @@
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Angle.hpp"
+#include "dubins/Trig.hpp"
+#include "dubins/Vector.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <optional>
+#include <vector>
+
+namespace dubins
+{
+namespace
+{
+double wrap_heading(double heading) noexcept
+{
+    return Angle::signed_difference(Angle{heading}, Angle{0.0});
+}
+
+void put_double(double value, std::uint8_t* out) noexcept
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (std::size_t i = 0; i < sizeof(bits); ++i)
+    {
+        out[i] = static_cast<std::uint8_t>(bits >> (8 * i));
+    }
+}
+
+double get_double(const std::uint8_t* in) noexcept
+{
+    std::uint64_t bits = 0;
+    for (std::size_t i = 0; i < sizeof(bits); ++i)
+    {
+        bits |= std::uint64_t{in[i]} << (8 * i);
+    }
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+template<typename States>
+void sample_impl(const PathDescriptor& path, double first, double spacing, std::size_t count, States& out)
+{
+    const auto types      = segment_types(path.word);
+    const auto boundaries = segment_boundaries(path);
+
+    out.reserve(out.size() + count);
+
+    std::size_t segment = 0;
+    double      offset  = 0.0;    // Distance of the current segment start from the path start
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto distance = std::max(0.0, first + double(i) * spacing);
+
+        while (segment < 2 && distance > offset + path.segments[segment])
+        {
+            offset += path.segments[segment];
+            ++segment;
+        }
+
+        const auto local = std::min(distance - offset, path.segments[segment]);
+        auto       state = advance(boundaries[segment], types[segment], path.radius, local);
+        state.heading    = wrap_heading(state.heading);
+        out.push_back(state);
+    }
+}
+
+// Largest angle an arc chord may span while deviating at most max_error from an arc of the given radius. The deviation
+// of a chord spanning angle a is its sagitta r * (1 - cos(a / 2)) = 2 r sin²(a / 4), the sine form stays positive for
+// errors so small that 1 - max_error / r rounds to one.
+double max_chord_angle(double radius, double max_error) noexcept
+{
+    return 4.0 * std::asin(std::sqrt(std::min(1.0, max_error / (2.0 * radius))));
+}
+
+template<typename States>
+void sample_adaptive_impl(const PathDescriptor& path, double max_error, States& out)
+{
+    if (!(max_error > 0.0))
+    {
+        return;
+    }
+
+    const auto types      = segment_types(path.word);
+    const auto boundaries = segment_boundaries(path);
+    const auto max_angle  = max_chord_angle(path.radius, max_error);
+
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        if (path.segments[i] <= 0.0)
+        {
+            continue;
+        }
+
+        // Lines are reproduced exactly by their end point, arcs are split into chords of equal angle
+        std::size_t count = 1;
+        if (types[i] != SegmentType::straight)
+        {
+            const auto chords = std::ceil(path.segments[i] / path.radius / max_angle);
+            count             = static_cast<std::size_t>(std::clamp(chords, 1.0, double(out.max_size())));
+        }
+
+        const auto spacing = path.segments[i] / double(count);
+        for (std::size_t j = 1; j <= count; ++j)
+        {
+            auto state    = j == count ? boundaries[i + 1]
+                                       : advance(boundaries[i], types[i], path.radius, double(j) * spacing);
+            state.heading = wrap_heading(state.heading);
+            out.push_back(state);
+        }
+    }
+}
+
+}    // namespace
+
+State advance(const State& from, SegmentType type, double radius, double distance) noexcept
+{
+    const auto u = unit_vector(from.heading);
+
+    switch (type)
+    {
+        case SegmentType::left:
+        {
+            const auto heading = from.heading + distance / radius;
+            const auto center  = from.position + radius * perpendicular(u);
+            return {center - radius * perpendicular(unit_vector(heading)), heading};
+        }
+        case SegmentType::right:
+        {
+            const auto heading = from.heading - distance / radius;
+            const auto center  = from.position - radius * perpendicular(u);
+            return {center + radius * perpendicular(unit_vector(heading)), heading};
+        }
+        case SegmentType::straight:
+        default: return {from.position + distance * u, from.heading};
+    }
+}
+
+std::array<State, 4> segment_boundaries(const PathDescriptor& path) noexcept
+{
+    const auto types = segment_types(path.word);
+
+    std::array<State, 4> boundaries;
+    boundaries[0] = path.start;
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        boundaries[i + 1] = advance(boundaries[i], types[i], path.radius, path.segments[i]);
+    }
+    return boundaries;
+}
+
+State state_at(const PathDescriptor& path, double distance) noexcept
+{
+    const auto types = segment_types(path.word);
+
+    distance = std::max(0.0, distance);
+
+    State state = path.start;
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        if (distance <= path.segments[i] || i == 2)
+        {
+            state = advance(state, types[i], path.radius, std::min(distance, path.segments[i]));
+            break;
+        }
+        state = advance(state, types[i], path.radius, path.segments[i]);
+        distance -= path.segments[i];
+    }
+
+    state.heading = wrap_heading(state.heading);
+    return state;
+}
+
+State end_state(const PathDescriptor& path) noexcept
+{
+    return state_at(path, length(path));
+}
+
+void sample(const PathDescriptor& path, double first, double spacing, std::size_t count, std::vector<State>& out)
+{
+    sample_impl(path, first, spacing, count, out);
+}
+
+void sample(const PathDescriptor& path, double first, double spacing, std::size_t count,
+            std::pmr::vector<State>& out)
+{
+    sample_impl(path, first, spacing, count, out);
+}
+
+void sample_adaptive(const PathDescriptor& path, double max_chord_error, std::vector<State>& out)
+{
+    sample_adaptive_impl(path, max_chord_error, out);
+}
+
+void sample_adaptive(const PathDescriptor& path, double max_chord_error, std::pmr::vector<State>& out)
+{
+    sample_adaptive_impl(path, max_chord_error, out);
+}
+
+std::array<std::uint8_t, encoded_descriptor_size> encode(const PathDescriptor& path) noexcept
+{
+    std::array<std::uint8_t, encoded_descriptor_size> data;
+
+    put_double(path.start.position.x, &data[0]);
+    put_double(path.start.position.y, &data[8]);
+    put_double(path.start.heading, &data[16]);
+    put_double(path.radius, &data[24]);
+    put_double(path.segments[0], &data[32]);
+    put_double(path.segments[1], &data[40]);
+    put_double(path.segments[2], &data[48]);
+    data[56] = static_cast<std::uint8_t>(path.word);
+
+    return data;
+}
+
+std::optional<PathDescriptor> decode(const std::uint8_t* data) noexcept
+{
+    if (data[56] > static_cast<std::uint8_t>(Word::RLR))
+    {
+        return std::nullopt;
+    }
+
+    PathDescriptor path;
+    path.start.position.x = get_double(&data[0]);
+    path.start.position.y = get_double(&data[8]);
+    path.start.heading    = get_double(&data[16]);
+    path.radius           = get_double(&data[24]);
+    path.segments[0]      = get_double(&data[32]);
+    path.segments[1]      = get_double(&data[40]);
+    path.segments[2]      = get_double(&data[48]);
+    path.word             = static_cast<Word>(data[56]);
+
+    return path;
+}
+
+}    // namespace dubins
@@ -0,0 +1,42 @@
+#include "dubins/Primitive.hpp"
+#include "dubins/Angle.hpp"
+#include "dubins/Trig.hpp"
+
+#include <array>
+#include <cmath>
+
+namespace dubins
+{
+Primitives primitives(const PathDescriptor& path) noexcept
+{
+    const auto types      = segment_types(path.word);
+    const auto boundaries = segment_boundaries(path);
+
+    Primitives result;
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        const auto& from = boundaries[i];
+
+        if (types[i] == SegmentType::straight)
+        {
+            result[i] = Line2D{from.position, boundaries[i + 1].position};
+            continue;
+        }
+
+        // The center lies a radius to the side of the heading, the vehicle is a quarter turn ahead of the center ray
+        const auto side = types[i] == SegmentType::left ? 1.0 : -1.0;
+
+        ArcPrimitive arc;
+        arc.direction   = types[i];
+        arc.radius      = path.radius;
+        arc.center      = from.position + side * path.radius * perpendicular(unit_vector(from.heading));
+        arc.sweep       = side * path.segments[i] / path.radius;
+        arc.start_angle = (double)Angle{from.heading - side * M_PI_2};
+        arc.end_angle   = (double)Angle{arc.start_angle + arc.sweep};
+        result[i]       = arc;
+    }
+
+    return result;
+}
+
+}    // namespace dubins
@@ -0,0 +1,125 @@
+#include "dubins/Projection.hpp"
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Trig.hpp"
+
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace dubins
+{
+namespace
+{
+// Wrap to [0, 2pi)
+double positive_angle(double angle) noexcept
+{
+    return (double)Angle{angle};
+}
+
+// Closest local arc length within [lo, hi] on a single segment starting at `from`
+double project_segment(const State& from, SegmentType type, double radius, double lo, double hi,
+                       const Vector2D& point) noexcept
+{
+    const auto u = unit_vector(from.heading);
+
+    if (type == SegmentType::straight)
+    {
+        return std::clamp(inner(point - from.position, u), lo, hi);
+    }
+
+    // Angle travelled from the segment start to the point's bearing from the center, in the direction of travel
+    const auto sign   = type == SegmentType::left ? 1.0 : -1.0;
+    const auto center = from.position + sign * radius * perpendicular(u);
+    const auto v      = point - center;
+    if (norm_sq(v) == 0.0)
+    {
+        return lo;    // Every point on the arc is equally close
+    }
+    const auto start = angle_of(from.position - center);
+    const auto t     = positive_angle(sign * (angle_of(v) - start)) * radius;
+
+    if (t >= lo && t <= hi)
+    {
+        return t;
+    }
+
+    // Outside of the window, the closer end is the one with the smaller angle to the point
+    const auto circumference = 2.0 * M_PI * radius;
+    const auto to_lo         = std::min(std::abs(t - lo), circumference - std::abs(t - lo));
+    const auto to_hi         = std::min(std::abs(t - hi), circumference - std::abs(t - hi));
+    return to_lo <= to_hi ? lo : hi;
+}
+
+Projection project_window(const PathDescriptor& path, const Vector2D& point, double lo, double hi) noexcept
+{
+    const auto types      = segment_types(path.word);
+    const auto boundaries = segment_boundaries(path);
+
+    Projection best{0.0, std::numeric_limits<double>::infinity()};
+
+    double offset = 0.0;
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        const auto seg_lo = std::max(0.0, lo - offset);
+        const auto seg_hi = std::min(path.segments[i], hi - offset);
+
+        if (seg_lo <= seg_hi)
+        {
+            const auto t = project_segment(boundaries[i], types[i], path.radius, seg_lo, seg_hi, point);
+            const auto d = norm(advance(boundaries[i], types[i], path.radius, t).position - point);
+
+            if (d < best.distance)
+            {
+                best = {offset + t, d};
+            }
+        }
+
+        offset += path.segments[i];
+    }
+
+    return best;
+}
+
+}    // namespace
+
+Projection project(const PathDescriptor& path, const Vector2D& point) noexcept
+{
+    return project_window(path, point, 0.0, length(path));
+}
+
+Projection project(const PathDescriptor& path, const Vector2D& point, double previous, double window) noexcept
+{
+    const auto len = length(path);
+    const auto lo  = std::clamp(previous - window, 0.0, len);
+    const auto hi  = std::clamp(previous + window, 0.0, len);
+    return project_window(path, point, lo, hi);
+}
+
+void project(const std::vector<PathDescriptor>& paths, const std::vector<Vector2D>& points,
+             std::vector<Projection>& out, std::size_t threads)
+{
+    out.resize(paths.size());
+    detail::parallel_for(paths.size(), threads, [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i)
+        {
+            out[i] = project(paths[i], points[i]);
+        }
+    });
+}
+
+void project(const std::vector<PathDescriptor>& paths, const std::vector<Vector2D>& points, double window,
+             std::vector<Projection>& inout, std::size_t threads)
+{
+    inout.resize(paths.size());
+    detail::parallel_for(paths.size(), threads, [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i)
+        {
+            inout[i] = project(paths[i], points[i], inout[i].arc_length, window);
+        }
+    });
+}
+
+}    // namespace dubins
@@ -0,0 +1,147 @@
+#include "dubins/QueryProtocol.hpp"
+
+#include <cstring>
+
+namespace dubins
+{
+namespace
+{
+void put_u32(std::uint32_t value, std::uint8_t* out) noexcept
+{
+    for (std::size_t i = 0; i < sizeof(value); ++i)
+    {
+        out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+    }
+}
+
+std::uint32_t get_u32(const std::uint8_t* in) noexcept
+{
+    std::uint32_t value = 0;
+    for (std::size_t i = 0; i < sizeof(value); ++i)
+    {
+        value |= std::uint32_t{in[i]} << (8 * i);
+    }
+    return value;
+}
+
+void put_double(double value, std::uint8_t* out) noexcept
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (std::size_t i = 0; i < sizeof(bits); ++i)
+    {
+        out[i] = static_cast<std::uint8_t>(bits >> (8 * i));
+    }
+}
+
+double get_double(const std::uint8_t* in) noexcept
+{
+    std::uint64_t bits = 0;
+    for (std::size_t i = 0; i < sizeof(bits); ++i)
+    {
+        bits |= std::uint64_t{in[i]} << (8 * i);
+    }
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void put_state(const State& state, std::uint8_t* out) noexcept
+{
+    put_double(state.position.x, out);
+    put_double(state.position.y, out + 8);
+    put_double(state.heading, out + 16);
+}
+
+State get_state(const std::uint8_t* in) noexcept
+{
+    return {{get_double(in), get_double(in + 8)}, get_double(in + 16)};
+}
+
+}    // namespace
+
+std::array<std::uint8_t, query_request_size> encode(const QueryRequest& request) noexcept
+{
+    std::array<std::uint8_t, query_request_size> data;
+
+    put_u32(request.id, &data[0]);
+    data[4] = static_cast<std::uint8_t>(request.type);
+    put_state(request.start, &data[5]);
+    put_state(request.end, &data[29]);
+    put_double(request.radius, &data[53]);
+    put_double(request.spacing, &data[61]);
+
+    return data;
+}
+
+std::optional<QueryRequest> decode_request(const std::uint8_t* data) noexcept
+{
+    const auto type = static_cast<QueryType>(data[4]);
+    if (type != QueryType::length && type != QueryType::samples)
+    {
+        return std::nullopt;
+    }
+
+    QueryRequest request;
+    request.id      = get_u32(&data[0]);
+    request.type    = type;
+    request.start   = get_state(&data[5]);
+    request.end     = get_state(&data[29]);
+    request.radius  = get_double(&data[53]);
+    request.spacing = get_double(&data[61]);
+    return request;
+}
+
+void encode(const QueryResponse& response, std::vector<std::uint8_t>& out)
+{
+    const auto offset = out.size();
+    out.resize(offset + query_response_header_size + query_sample_size * response.samples.size());
+
+    auto* data = out.data() + offset;
+    put_u32(response.id, &data[0]);
+    data[4] = static_cast<std::uint8_t>(response.status);
+    put_double(response.length, &data[5]);
+    put_u32(static_cast<std::uint32_t>(response.samples.size()), &data[13]);
+
+    data += query_response_header_size;
+    for (const auto& state : response.samples)
+    {
+        put_state(state, data);
+        data += query_sample_size;
+    }
+}
+
+std::size_t response_size(const std::uint8_t* header) noexcept
+{
+    const auto status = static_cast<QueryStatus>(header[4]);
+    const auto count  = get_u32(&header[13]);
+    if ((status != QueryStatus::ok && status != QueryStatus::invalid) || count > max_response_samples)
+    {
+        return 0;
+    }
+    return query_response_header_size + query_sample_size * std::size_t{count};
+}
+
+std::optional<QueryResponse> decode_response(const std::uint8_t* data, std::size_t size)
+{
+    if (size < query_response_header_size || response_size(data) != size)
+    {
+        return std::nullopt;
+    }
+
+    QueryResponse response;
+    response.id     = get_u32(&data[0]);
+    response.status = static_cast<QueryStatus>(data[4]);
+    response.length = get_double(&data[5]);
+    response.samples.resize(get_u32(&data[13]));
+
+    data += query_response_header_size;
+    for (auto& state : response.samples)
+    {
+        state = get_state(data);
+        data += query_sample_size;
+    }
+    return response;
+}
+
+}    // namespace dubins
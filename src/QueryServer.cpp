@@ -0,0 +1,688 @@
+#include "dubins/QueryServer.hpp"
+#include "dubins/OneToMany.hpp"
+#include "dubins/PathDescriptor.hpp"
+
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define DUBINS_HAS_SOCKETS 1
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace dubins
+{
+#ifdef DUBINS_HAS_SOCKETS
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// Recent latencies kept for the percentiles
+constexpr std::size_t latency_window = 4096;
+
+// Requests per worker thread before a batch is split
+constexpr std::size_t requests_per_thread = 256;
+
+// How often the acceptor looks for a stop request
+constexpr int accept_poll_ms = 50;
+
+// A client that stops reading its responses for this long is dropped, so it can not stall the batches of the others
+constexpr int send_timeout_s = 1;
+
+// A client that went away must not kill the server with SIGPIPE
+#if defined(MSG_NOSIGNAL)
+constexpr int send_flags = MSG_NOSIGNAL;
+#else
+constexpr int send_flags = 0;
+#endif
+
+bool write_all(int fd, const std::uint8_t* data, std::size_t size) noexcept
+{
+    while (size > 0)
+    {
+        const auto written = ::send(fd, data, size, send_flags);
+        if (written <= 0)
+        {
+            return false;
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+bool read_all(int fd, std::uint8_t* data, std::size_t size) noexcept
+{
+    while (size > 0)
+    {
+        const auto received = ::recv(fd, data, size, 0);
+        if (received <= 0)
+        {
+            return false;
+        }
+        data += received;
+        size -= static_cast<std::size_t>(received);
+    }
+    return true;
+}
+
+std::optional<sockaddr_un> socket_address(const std::string& path) noexcept
+{
+    sockaddr_un address{};
+    if (path.empty() || path.size() >= sizeof(address.sun_path))
+    {
+        return std::nullopt;
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return address;
+}
+
+// A socket left behind by a server that exited is removed. Anything else at the path, a live server's socket or a file
+// that is not a socket, is left alone and the path can not be used.
+bool clear_socket_path(const std::string& path, const sockaddr_un& address) noexcept
+{
+    struct stat info{};
+    if (::lstat(path.c_str(), &info) != 0)
+    {
+        return errno == ENOENT;
+    }
+    if (!S_ISSOCK(info.st_mode))
+    {
+        return false;
+    }
+
+    const auto probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe < 0)
+    {
+        return false;
+    }
+    const auto live = ::connect(probe, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+    ::close(probe);
+    return !live && ::unlink(path.c_str()) == 0;
+}
+
+void no_sigpipe(int fd) noexcept
+{
+#if defined(SO_NOSIGPIPE)
+    int on = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#else
+    (void)fd;
+#endif
+}
+
+void send_timeout(int fd) noexcept
+{
+    timeval timeout{};
+    timeout.tv_sec = send_timeout_s;
+    ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+}
+
+bool finite(const State& state) noexcept
+{
+    return std::isfinite(state.position.x) && std::isfinite(state.position.y) && std::isfinite(state.heading);
+}
+
+bool valid(const QueryRequest& request) noexcept
+{
+    return finite(request.start) && finite(request.end) && std::isfinite(request.radius) && request.radius > 0.0
+           && (request.type != QueryType::samples || (std::isfinite(request.spacing) && request.spacing > 0.0));
+}
+
+// Client connection, closed once the reader and every queued request are done with it
+struct Connection
+{
+    explicit Connection(int fd_) noexcept : fd{fd_} {}
+    ~Connection() { ::close(fd); }
+
+    int               fd;
+    std::atomic<bool> finished{false};    ///< Reader thread has returned
+};
+
+struct Pending
+{
+    QueryRequest                request;
+    std::shared_ptr<Connection> connection;
+    Clock::time_point           received;
+};
+
+}    // namespace
+
+class QueryServer::Impl
+{
+    public:
+    Impl(const Options& options, int fd, const struct stat& bound) :
+        m_options{options}, m_listen_fd{fd}, m_device{bound.st_dev}, m_inode{bound.st_ino}, m_pool{options.threads}
+    {
+        m_options.max_batch = std::max<std::size_t>(m_options.max_batch, 1);
+        m_latencies.reserve(latency_window);
+
+        m_batcher  = std::thread{[this]() { batch_loop(); }};
+        m_acceptor = std::thread{[this]() { accept_loop(); }};
+    }
+
+    ~Impl() { stop(); }
+
+    void stop()
+    {
+        if (m_stopping.exchange(true))
+        {
+            return;
+        }
+
+        m_acceptor.join();
+        ::close(m_listen_fd);
+
+        // Another server may have replaced the socket since, its socket is not ours to remove
+        struct stat info{};
+        if (::lstat(m_options.socket_path.c_str(), &info) == 0 && S_ISSOCK(info.st_mode) && info.st_dev == m_device
+            && info.st_ino == m_inode)
+        {
+            ::unlink(m_options.socket_path.c_str());
+        }
+
+        // Wake the readers, then let the batcher drain what they queued
+        std::vector<std::pair<std::shared_ptr<Connection>, std::thread>> readers;
+        {
+            std::lock_guard<std::mutex> lock{m_readers_mutex};
+            readers.swap(m_readers);
+        }
+        for (auto& [connection, thread] : readers)
+        {
+            ::shutdown(connection->fd, SHUT_RD);
+        }
+        for (auto& [connection, thread] : readers)
+        {
+            thread.join();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{m_queue_mutex};
+            m_closed = true;
+        }
+        m_queue_ready.notify_all();
+        m_batcher.join();
+        m_pool.stop();
+    }
+
+    Metrics metrics() const
+    {
+        std::lock_guard<std::mutex> lock{m_metrics_mutex};
+
+        auto out = m_metrics;
+        if (out.batches > 0)
+        {
+            out.mean_batch_size = static_cast<double>(out.requests) / static_cast<double>(out.batches);
+        }
+        const auto elapsed = std::chrono::duration<double>(Clock::now() - m_started).count();
+        if (elapsed > 0.0)
+        {
+            out.throughput = static_cast<double>(out.requests) / elapsed;
+        }
+
+        if (!m_latencies.empty())
+        {
+            auto       sorted = m_latencies;
+            const auto at     = [&](double q) {
+                const auto k = static_cast<std::size_t>(q * static_cast<double>(sorted.size() - 1));
+                std::nth_element(sorted.begin(), sorted.begin() + k, sorted.end());
+                return sorted[k];
+            };
+            out.latency_p50 = at(0.5);
+            out.latency_p99 = at(0.99);
+            out.latency_max = at(1.0);
+        }
+        return out;
+    }
+
+    const Options& options() const noexcept { return m_options; }
+
+    private:
+    void accept_loop()
+    {
+        while (!m_stopping)
+        {
+            pollfd listen{m_listen_fd, POLLIN, 0};
+            if (::poll(&listen, 1, accept_poll_ms) <= 0)
+            {
+                continue;
+            }
+
+            const auto fd = ::accept(m_listen_fd, nullptr, nullptr);
+            if (fd < 0)
+            {
+                continue;
+            }
+            no_sigpipe(fd);
+            send_timeout(fd);
+
+            auto connection = std::make_shared<Connection>(fd);
+            {
+                std::lock_guard<std::mutex> lock{m_metrics_mutex};
+                ++m_metrics.connections;
+            }
+
+            std::lock_guard<std::mutex> lock{m_readers_mutex};
+
+            // Join the readers of connections that closed
+            auto done = std::partition(m_readers.begin(), m_readers.end(),
+                                       [](const auto& reader) { return !reader.first->finished; });
+            for (auto it = done; it != m_readers.end(); ++it)
+            {
+                it->second.join();
+            }
+            m_readers.erase(done, m_readers.end());
+
+            m_readers.emplace_back(connection, std::thread{[this, connection]() { read_loop(connection); }});
+        }
+    }
+
+    void read_loop(const std::shared_ptr<Connection>& connection)
+    {
+        std::array<std::uint8_t, query_request_size> data;
+        while (read_all(connection->fd, data.data(), data.size()))
+        {
+            // An unknown request type means the stream is out of step, so the connection is dropped
+            const auto request = decode_request(data.data());
+            if (!request)
+            {
+                ::shutdown(connection->fd, SHUT_RDWR);
+                break;
+            }
+
+            std::lock_guard<std::mutex> lock{m_queue_mutex};
+            m_queue.push_back({*request, connection, Clock::now()});
+            if (m_queue.size() == 1 || m_queue.size() >= m_options.max_batch)
+            {
+                m_queue_ready.notify_one();
+            }
+        }
+        connection->finished = true;
+    }
+
+    void batch_loop()
+    {
+        std::vector<Pending>         batch;
+        std::unique_lock<std::mutex> lock{m_queue_mutex};
+        while (true)
+        {
+            m_queue_ready.wait(lock, [this]() { return !m_queue.empty() || m_closed; });
+            if (m_queue.empty())
+            {
+                return;
+            }
+
+            // Give the batch until the oldest request has waited long enough to fill up
+            const auto deadline = m_queue.front().received + m_options.max_latency;
+            m_queue_ready.wait_until(lock, deadline,
+                                     [this]() { return m_queue.size() >= m_options.max_batch || m_closed; });
+
+            batch.clear();
+            batch.swap(m_queue);
+            lock.unlock();
+            answer(batch);
+            lock.lock();
+        }
+    }
+
+    void answer(const std::vector<Pending>& batch)
+    {
+        const auto                 n = batch.size();
+        std::vector<QueryResponse> responses(n);
+
+        // Queries from the same start with the same radius are solved together
+        std::vector<std::uint32_t> order;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const auto& request = batch[i].request;
+            responses[i].id     = request.id;
+            if (valid(request))
+            {
+                order.push_back(static_cast<std::uint32_t>(i));
+            }
+            else
+            {
+                responses[i].status = QueryStatus::invalid;
+            }
+        }
+
+        const auto key = [&](std::uint32_t i) {
+            const auto& r = batch[i].request;
+            return std::make_tuple(r.start.position.x, r.start.position.y, r.start.heading, r.radius);
+        };
+        std::sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) { return key(a) < key(b); });
+
+        std::vector<std::size_t> groups{0};
+        for (std::size_t k = 1; k <= order.size(); ++k)
+        {
+            if (k == order.size() || key(order[k]) != key(order[k - 1]))
+            {
+                groups.push_back(k);
+            }
+        }
+
+        const auto threads = std::max<std::size_t>(1, order.size() / requests_per_thread);
+        m_pool.parallel_for(groups.size() - 1, threads, [&](std::size_t begin, std::size_t end) {
+            std::vector<State>          goals;
+            std::vector<PathDescriptor> paths;
+            for (std::size_t g = begin; g < end; ++g)
+            {
+                const auto& first = batch[order[groups[g]]].request;
+
+                goals.clear();
+                for (std::size_t k = groups[g]; k < groups[g + 1]; ++k)
+                {
+                    goals.push_back(batch[order[k]].request.end);
+                }
+                one_to_many(first.start, goals, first.radius, paths);
+
+                for (std::size_t k = groups[g]; k < groups[g + 1]; ++k)
+                {
+                    const auto  i        = order[k];
+                    const auto& path     = paths[k - groups[g]];
+                    auto&       response = responses[i];
+                    response.length      = length(path);
+                    if (batch[i].request.type == QueryType::samples)
+                    {
+                        sample_path(path, batch[i].request.spacing, response);
+                    }
+                }
+            }
+        });
+
+        // One write per connection
+        std::unordered_map<Connection*, std::vector<std::uint8_t>> buffers;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            encode(responses[i], buffers[batch[i].connection.get()]);
+        }
+        for (const auto& [connection, buffer] : buffers)
+        {
+            // A partial write leaves the stream out of step
+            if (!write_all(connection->fd, buffer.data(), buffer.size()))
+            {
+                ::shutdown(connection->fd, SHUT_RDWR);
+            }
+        }
+
+        const auto                  now = Clock::now();
+        std::lock_guard<std::mutex> lock{m_metrics_mutex};
+        ++m_metrics.batches;
+        m_metrics.requests += n;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            m_metrics.invalid += responses[i].status == QueryStatus::invalid;
+
+            const auto latency = std::chrono::duration<double>(now - batch[i].received).count();
+            if (m_latencies.size() < latency_window)
+            {
+                m_latencies.push_back(latency);
+            }
+            else
+            {
+                m_latencies[m_latency_next] = latency;
+            }
+            m_latency_next = (m_latency_next + 1) % latency_window;
+        }
+    }
+
+    void sample_path(const PathDescriptor& path, double spacing, QueryResponse& response) const
+    {
+        const auto len   = length(path);
+        const auto steps = std::max(1.0, std::ceil(len / spacing));
+        if (steps + 1.0 > static_cast<double>(std::min<std::size_t>(m_options.max_samples, max_response_samples)))
+        {
+            response.status = QueryStatus::invalid;
+            return;
+        }
+
+        const auto count = static_cast<std::size_t>(steps) + 1;
+        response.samples.reserve(count);
+        sample(path, 0.0, len / steps, count, response.samples);
+    }
+
+    Options                                                          m_options;
+    int                                                              m_listen_fd;
+    dev_t                                                            m_device;    ///< Identity of the bound socket file
+    ino_t                                                            m_inode;
+    std::atomic<bool>                                                m_stopping{false};
+    std::thread                                                      m_acceptor;
+    std::thread                                                      m_batcher;
+    std::mutex                                                       m_readers_mutex;
+    std::vector<std::pair<std::shared_ptr<Connection>, std::thread>> m_readers;
+    std::mutex                                                       m_queue_mutex;
+    std::condition_variable                                          m_queue_ready;
+    std::vector<Pending>                                             m_queue;
+    bool                                                             m_closed{false};
+    mutable std::mutex                                               m_metrics_mutex;
+    Metrics                                                          m_metrics;
+    Clock::time_point                                                m_started{Clock::now()};
+    std::vector<double>                                              m_latencies;    ///< Recent latencies, seconds
+    std::size_t                                                      m_latency_next{0};
+    detail::WorkerPool                                               m_pool;    ///< Splits batches, joined by stop()
+};
+
+std::optional<QueryServer> QueryServer::start(const Options& options)
+{
+    const auto address = socket_address(options.socket_path);
+    if (!address)
+    {
+        return std::nullopt;
+    }
+
+    const auto fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        return std::nullopt;
+    }
+
+    struct stat bound{};
+    if (!clear_socket_path(options.socket_path, *address)
+        || ::bind(fd, reinterpret_cast<const sockaddr*>(&*address), sizeof(*address)) != 0
+        || ::lstat(options.socket_path.c_str(), &bound) != 0 || ::listen(fd, SOMAXCONN) != 0)
+    {
+        ::close(fd);
+        return std::nullopt;
+    }
+
+    return QueryServer{std::make_unique<Impl>(options, fd, bound)};
+}
+
+std::optional<QueryClient> QueryClient::connect(const std::string& socket_path)
+{
+    const auto address = socket_address(socket_path);
+    if (!address)
+    {
+        return std::nullopt;
+    }
+
+    const auto fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        return std::nullopt;
+    }
+    if (::connect(fd, reinterpret_cast<const sockaddr*>(&*address), sizeof(*address)) != 0)
+    {
+        ::close(fd);
+        return std::nullopt;
+    }
+
+    no_sigpipe(fd);
+    return QueryClient{fd};
+}
+
+QueryClient::~QueryClient()
+{
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+    }
+}
+
+bool QueryClient::send(const QueryRequest& request)
+{
+    const auto data = encode(request);
+    return write_all(m_fd, data.data(), data.size());
+}
+
+std::optional<QueryResponse> QueryClient::receive()
+{
+    std::vector<std::uint8_t> data(query_response_header_size);
+    if (!read_all(m_fd, data.data(), data.size()))
+    {
+        return std::nullopt;
+    }
+
+    const auto size = response_size(data.data());
+    if (size == 0)
+    {
+        return std::nullopt;
+    }
+    data.resize(size);
+    if (!read_all(m_fd, data.data() + query_response_header_size, size - query_response_header_size))
+    {
+        return std::nullopt;
+    }
+    return decode_response(data.data(), data.size());
+}
+
+#else
+
+// Stubs where Unix domain sockets are not available: the server never starts and clients never connect
+class QueryServer::Impl
+{
+    public:
+    void           stop() {}
+    Metrics        metrics() const { return {}; }
+    const Options& options() const noexcept { return m_options; }
+
+    private:
+    Options m_options;
+};
+
+std::optional<QueryServer> QueryServer::start(const Options&)
+{
+    return std::nullopt;
+}
+
+std::optional<QueryClient> QueryClient::connect(const std::string&)
+{
+    return std::nullopt;
+}
+
+QueryClient::~QueryClient() = default;
+
+bool QueryClient::send(const QueryRequest&)
+{
+    return false;
+}
+
+std::optional<QueryResponse> QueryClient::receive()
+{
+    return std::nullopt;
+}
+
+#endif
+
+QueryServer::QueryServer(std::unique_ptr<Impl> impl) noexcept : m_impl{std::move(impl)} {}
+
+QueryServer::~QueryServer() = default;
+
+QueryServer::QueryServer(QueryServer&& other) noexcept = default;
+
+QueryServer& QueryServer::operator=(QueryServer&& other) noexcept = default;
+
+void QueryServer::stop()
+{
+    if (m_impl)
+    {
+        m_impl->stop();
+    }
+}
+
+QueryServer::Metrics QueryServer::metrics() const
+{
+    return m_impl->metrics();
+}
+
+const QueryServer::Options& QueryServer::options() const noexcept
+{
+    return m_impl->options();
+}
+
+QueryClient::QueryClient(int fd) noexcept : m_fd{fd} {}
+
+QueryClient::QueryClient(QueryClient&& other) noexcept : m_fd{std::exchange(other.m_fd, -1)},
+                                                          m_next_id{other.m_next_id}
+{
+}
+
+QueryClient& QueryClient::operator=(QueryClient&& other) noexcept
+{
+    std::swap(m_fd, other.m_fd);
+    std::swap(m_next_id, other.m_next_id);
+    return *this;
+}
+
+std::optional<double> QueryClient::length(const State& start, const State& end, double radius)
+{
+    QueryRequest request;
+    request.id     = m_next_id++;
+    request.type   = QueryType::length;
+    request.start  = start;
+    request.end    = end;
+    request.radius = radius;
+
+    if (!send(request))
+    {
+        return std::nullopt;
+    }
+    const auto response = receive();
+    if (!response || response->status != QueryStatus::ok)
+    {
+        return std::nullopt;
+    }
+    return response->length;
+}
+
+std::optional<std::vector<State>> QueryClient::samples(const State& start, const State& end, double radius,
+                                                       double spacing)
+{
+    QueryRequest request;
+    request.id      = m_next_id++;
+    request.type    = QueryType::samples;
+    request.start   = start;
+    request.end     = end;
+    request.radius  = radius;
+    request.spacing = spacing;
+
+    if (!send(request))
+    {
+        return std::nullopt;
+    }
+    auto response = receive();
+    if (!response || response->status != QueryStatus::ok)
+    {
+        return std::nullopt;
+    }
+    return std::move(response->samples);
+}
+
+}    // namespace dubins
@@ -0,0 +1,236 @@
+#include "dubins/Raster.hpp"
+#include "dubins/Angle.hpp"
+#include "dubins/Bounds.hpp"
+#include "dubins/Primitive.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <unordered_set>
+#include <variant>
+#include <vector>
+
+namespace dubins
+{
+namespace
+{
+// Intervals between grid line crossings shorter than this (in path parameter) are corners and are not visited
+constexpr double min_interval = 1e-12;
+
+// Emits each in-grid cell once, skipping repeats of the previous cell without a hash lookup
+class Walker
+{
+    public:
+    Walker(const Grid& grid, const CellVisitor& visit) : m_grid{grid}, m_visit{visit} {}
+
+    bool emit(const Vector2D& point)
+    {
+        // Points more than a cell outside the grid can not touch it, and far enough out their cell index overflows
+        const auto local = (point - m_grid.origin) / m_grid.resolution;
+        if (!(local.x >= -1.0 && local.y >= -1.0 && local.x < double(m_grid.width) + 1.0
+              && local.y < double(m_grid.height) + 1.0))
+        {
+            return true;
+        }
+
+        const Cell cell{static_cast<std::int32_t>(std::floor(local.x)), static_cast<std::int32_t>(std::floor(local.y))};
+
+        if (m_last.has_value() && m_last.value() == cell)
+        {
+            return true;
+        }
+        m_last = cell;
+
+        if (cell.x < 0 || cell.y < 0 || cell.x >= m_grid.width || cell.y >= m_grid.height)
+        {
+            return true;
+        }
+
+        const auto key = (std::uint64_t(std::uint32_t(cell.y)) << 32) | std::uint32_t(cell.x);
+        if (m_visited.insert(key).second == false)
+        {
+            return true;
+        }
+
+        return m_visit(cell);
+    }
+
+    const Grid& grid() const noexcept { return m_grid; }
+
+    private:
+    const Grid&                        m_grid;
+    const CellVisitor&                 m_visit;
+    std::optional<Cell>                m_last;
+    std::unordered_set<std::uint64_t> m_visited;
+};
+
+// Visit the cell of each interval between consecutive crossings. A cell is identified from the interval midpoint, so
+// rounding in the crossings can never push the walk into the wrong row or column.
+template<typename PointAt>
+bool walk_intervals(Walker& walker, const std::vector<double>& crossings, double end, PointAt&& point_at)
+{
+    double previous = 0.0;
+    for (const auto next : crossings)
+    {
+        if (next - previous > min_interval)
+        {
+            if (walker.emit(point_at(0.5 * (previous + next))) == false)
+            {
+                return false;
+            }
+            previous = next;
+        }
+    }
+    return walker.emit(point_at(0.5 * (previous + end)));
+}
+
+bool traverse_primitive(Walker& walker, const Line2D& line)
+{
+    const auto& grid = walker.grid();
+    const auto  a    = (line.a - grid.origin) / grid.resolution;
+    const auto  d    = (line.b - grid.origin) / grid.resolution - a;
+
+    // Amanatides-Woo: parameter of the next crossing on each axis and the parameter step between crossings
+    const auto first_crossing = [](double p, double dp) {
+        if (dp > 0.0)
+        {
+            return (std::floor(p) + 1.0 - p) / dp;
+        }
+        if (dp < 0.0)
+        {
+            return (p - (std::ceil(p) - 1.0)) / -dp;
+        }
+        return std::numeric_limits<double>::infinity();
+    };
+
+    auto       t_max_x   = first_crossing(a.x, d.x);
+    auto       t_max_y   = first_crossing(a.y, d.y);
+    const auto t_delta_x = d.x != 0.0 ? 1.0 / std::abs(d.x) : std::numeric_limits<double>::infinity();
+    const auto t_delta_y = d.y != 0.0 ? 1.0 / std::abs(d.y) : std::numeric_limits<double>::infinity();
+
+    std::vector<double> crossings;
+    while (std::min(t_max_x, t_max_y) < 1.0)
+    {
+        if (t_max_x < t_max_y)
+        {
+            crossings.push_back(t_max_x);
+            t_max_x += t_delta_x;
+        }
+        else
+        {
+            crossings.push_back(t_max_y);
+            t_max_y += t_delta_y;
+        }
+    }
+
+    return walk_intervals(walker, crossings, 1.0, [&](double t) { return line.a + t * (line.b - line.a); });
+}
+
+bool traverse_primitive(Walker& walker, const ArcPrimitive& arc)
+{
+    const auto& grid  = walker.grid();
+    const auto  sweep = std::abs(arc.sweep);
+    const auto  side  = arc.sweep >= 0.0 ? 1.0 : -1.0;
+
+    const auto point_at = [&](double travel) {
+        const auto angle = arc.start_angle + side * travel;
+        return arc.center + arc.radius * Vector2D{std::cos(angle), std::sin(angle)};
+    };
+
+    // Angle travelled from the arc start to a point of the circle
+    const Angle start{arc.start_angle};
+    const auto  travel_to = [&](double angle) {
+        return side > 0.0 ? Angle::positive_difference(Angle{angle}, start)
+                          : Angle::positive_difference(start, Angle{angle});
+    };
+
+    // Crossings of the circle with every grid line inside the bounding box of the arc. The circle crosses x = X at
+    // angles +-acos((X - cx) / r) and y = Y at angles asin((Y - cy) / r) and pi - asin((Y - cy) / r).
+    const auto box = bounds(arc);
+
+    std::vector<double> crossings;
+    const auto          add = [&](double angle) {
+        const auto travel = travel_to(angle);
+        if (travel > 0.0 && travel < sweep)
+        {
+            crossings.push_back(travel);
+        }
+    };
+
+    const auto first_x = std::ceil((box.min.x - grid.origin.x) / grid.resolution);
+    const auto last_x  = std::floor((box.max.x - grid.origin.x) / grid.resolution);
+    for (auto k = first_x; k <= last_x; k += 1.0)
+    {
+        const auto u = (grid.origin.x + k * grid.resolution - arc.center.x) / arc.radius;
+        if (std::abs(u) < 1.0)
+        {
+            const auto angle = std::acos(u);
+            add(angle);
+            add(-angle);
+        }
+    }
+
+    const auto first_y = std::ceil((box.min.y - grid.origin.y) / grid.resolution);
+    const auto last_y  = std::floor((box.max.y - grid.origin.y) / grid.resolution);
+    for (auto k = first_y; k <= last_y; k += 1.0)
+    {
+        const auto v = (grid.origin.y + k * grid.resolution - arc.center.y) / arc.radius;
+        if (std::abs(v) < 1.0)
+        {
+            const auto angle = std::asin(v);
+            add(angle);
+            add(M_PI - angle);
+        }
+    }
+
+    std::sort(crossings.begin(), crossings.end());
+
+    return walk_intervals(walker, crossings, sweep, point_at);
+}
+
+}    // namespace
+
+bool traverse(const PathDescriptor& path, const Grid& grid, const CellVisitor& visit)
+{
+    Walker walker{grid, visit};
+
+    for (const auto& primitive : primitives(path))
+    {
+        const auto completed = std::visit([&](const auto& p) { return traverse_primitive(walker, p); }, primitive);
+
+        if (completed == false)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::vector<Cell> rasterize(const PathDescriptor& path, const Grid& grid)
+{
+    std::vector<Cell> cells;
+    traverse(path, grid, [&](const Cell& cell) {
+        cells.push_back(cell);
+        return true;
+    });
+    return cells;
+}
+
+std::optional<Cell> first_occupied(const PathDescriptor& path, const Grid& grid, const std::uint8_t* occupancy)
+{
+    std::optional<Cell> hit;
+    traverse(path, grid, [&](const Cell& cell) {
+        if (occupancy[std::size_t(cell.y) * std::size_t(grid.width) + std::size_t(cell.x)] != 0)
+        {
+            hit = cell;
+            return false;
+        }
+        return true;
+    });
+    return hit;
+}
+
+}    // namespace dubins
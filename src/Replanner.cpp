@@ -0,0 +1,230 @@
+#include "dubins/Replanner.hpp"
+#include "dubins/PathDescriptor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace dubins
+{
+namespace
+{
+constexpr double infinity = std::numeric_limits<double>::infinity();
+
+// Bound on how far the turning circle centers of a state moved
+double circle_drift(const State& now, const State& ref, double radius) noexcept
+{
+    return norm(now.position - ref.position) + radius * std::abs(std::remainder(now.heading - ref.heading, 2.0 * M_PI));
+}
+
+// Distance between the two turning circles a word travels on (the outer ones for CCC words)
+double center_distance(const TurningCircles& start, const TurningCircles& end, Word word) noexcept
+{
+    switch (word)
+    {
+        case Word::LSL:
+        case Word::LRL: return norm(end.left.center - start.left.center);
+        case Word::RSR:
+        case Word::RLR: return norm(end.right.center - start.right.center);
+        case Word::RSL: return norm(end.left.center - start.right.center);
+        case Word::LSR: return norm(end.right.center - start.left.center);
+    }
+    return 0.0;
+}
+
+double max_arc_angle(const PathDescriptor& path) noexcept
+{
+    const auto types = segment_types(path.word);
+
+    double angle = 0.0;
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        if (types[i] != SegmentType::straight)
+        {
+            angle = std::max(angle, path.segments[i] / path.radius);
+        }
+    }
+    return angle;
+}
+
+}    // namespace
+
+Replanner::Replanner(const State& start, const State& end, double radius) noexcept :
+    m_radius{radius}, m_start{start}, m_end{end}
+{
+    evaluate_all();
+}
+
+bool Replanner::update_start(const State& start) noexcept
+{
+    return update(start, m_end);
+}
+
+bool Replanner::update_end(const State& end) noexcept
+{
+    return update(m_start, end);
+}
+
+bool Replanner::update(const State& start, const State& end) noexcept
+{
+    m_start = start;
+    m_end   = end;
+
+    // Re-evaluate the previously optimal word only
+    const auto previous  = m_path.word;
+    const auto candidate = word_path(start, end, m_radius, previous);
+    const auto len       = dubins::length(candidate);
+
+    const auto drift = circle_drift(start, m_ref_start, m_radius) + circle_drift(end, m_ref_end, m_radius);
+
+    bool full = std::isfinite(len) == false;
+    for (std::size_t idx = 0; idx < m_lengths.size() && full == false; ++idx)
+    {
+        if (idx != static_cast<std::size_t>(previous) && lower_bound(idx, drift) < len)
+        {
+            full = true;
+        }
+    }
+
+    if (full)
+    {
+        evaluate_all();
+    }
+    else
+    {
+        m_path = candidate;
+    }
+
+    return m_path.word != previous;
+}
+
+const PathDescriptor& Replanner::path() const noexcept
+{
+    return m_path;
+}
+
+double Replanner::length() const noexcept
+{
+    return dubins::length(m_path);
+}
+
+Word Replanner::word() const noexcept
+{
+    return m_path.word;
+}
+
+std::size_t Replanner::full_evaluations() const noexcept
+{
+    return m_full_evaluations;
+}
+
+void Replanner::evaluate_all() noexcept
+{
+    const auto start = turning_circles(m_start, m_radius);
+    const auto end   = turning_circles(m_end, m_radius);
+
+    double best = infinity;
+    for (std::size_t idx = 0; idx < m_lengths.size(); ++idx)
+    {
+        const auto word = static_cast<Word>(idx);
+        const auto path = word_path(start, end, word);
+
+        m_lengths[idx]   = dubins::length(path);
+        m_distances[idx] = center_distance(start, end, word);
+        m_max_arc[idx]   = std::isfinite(m_lengths[idx]) ? max_arc_angle(path) : 0.0;
+
+        if (m_lengths[idx] < best)
+        {
+            best   = m_lengths[idx];
+            m_path = path;
+        }
+    }
+
+    m_ref_start = m_start;
+    m_ref_end   = m_end;
+    ++m_full_evaluations;
+}
+
+double Replanner::lower_bound(std::size_t idx, double drift) const noexcept
+{
+    if (drift == 0.0)
+    {
+        return m_lengths[idx];
+    }
+
+    // Moving both states so that each turning circle center moves at most `drift` combined changes the vector
+    // between the centers by at most `drift`, and the start/end headings by at most `drift / r` combined.
+    const auto r     = m_radius;
+    const auto word  = static_cast<Word>(idx);
+    const auto d     = m_distances[idx];
+    const auto d_min = d - drift;
+    const auto d_max = d + drift;
+
+    double gain      = 0.0;    // Bound on |dL| / drift
+    double max_twist = 0.0;    // Bound on the change of any arc angle
+
+    switch (word)
+    {
+        case Word::LSL:
+        case Word::RSR:
+        {
+            // L = r*a1 + d + r*a2, the direction between centers cancels out of the arc angles
+            if (d_min <= 0.0)
+            {
+                return -infinity;
+            }
+            gain      = 2.0;
+            max_twist = drift / d_min + drift / r;
+            break;
+        }
+        case Word::RSL:
+        case Word::LSR:
+        {
+            // Inner tangent exists while d > 2r, with length l = sqrt(d^2 - 4r^2)
+            if (std::isfinite(m_lengths[idx]) == false)
+            {
+                return d_max >= 2.0 * r ? -infinity : infinity;
+            }
+            if (d_min <= 2.0 * r)
+            {
+                return -infinity;
+            }
+            const auto l_min = std::sqrt(d_min * d_min - 4.0 * r * r);
+            const auto twist = drift / d_min + 2.0 * r * drift / (d_min * l_min);
+
+            gain      = 1.0 + 2.0 * r / d_min + (4.0 * r * r + d_max * d_max) / (d_min * l_min);
+            max_twist = twist + drift / r;
+            break;
+        }
+        case Word::LRL:
+        case Word::RLR:
+        {
+            // The transfer circle is solved for while d^2 <= 12r^2 (see calculate_transfer_circle), its angle at the
+            // outer centers is acos(d / 4r).
+            const auto d_feasible = std::sqrt(12.0) * r;
+            if (std::isfinite(m_lengths[idx]) == false)
+            {
+                return d_min <= d_feasible ? -infinity : infinity;
+            }
+            if (d_min <= 0.0 || d_max >= d_feasible)
+            {
+                return -infinity;
+            }
+            const auto g = std::sqrt(16.0 * r * r - d_max * d_max);
+
+            gain      = 1.0 + 2.0 * r / d_min + 4.0 * r / g;
+            max_twist = drift / d_min + 2.0 * drift / g + drift / r;
+            break;
+        }
+    }
+
+    // An arc close to a full turn can wrap to zero, shortening the word by 2 pi r
+    if (m_max_arc[idx] + max_twist >= 2.0 * M_PI)
+    {
+        return -infinity;
+    }
+
+    return m_lengths[idx] - gain * drift;
+}
+
+}    // namespace dubins
@@ -0,0 +1,383 @@
+#include "dubins/Roadmap.hpp"
+#include "dubins/OneToMany.hpp"
+#include "dubins/Projection.hpp"
+
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <random>
+
+namespace dubins
+{
+namespace
+{
+constexpr std::uint32_t no_node = std::numeric_limits<std::uint32_t>::max();
+
+// Uniform grid over the nodes, with the nodes of each cell stored contiguously
+class NodeGrid
+{
+    public:
+    NodeGrid(const std::vector<State>& nodes, std::size_t per_cell)
+    {
+        BoundingBox box;
+        for (const auto& node : nodes)
+        {
+            expand(box, node.position);
+        }
+        if (nodes.empty())
+        {
+            return;
+        }
+
+        // Cells sized so that each holds about per_cell nodes when they are spread evenly
+        const auto extent = box.max - box.min;
+        const auto area   = std::max(extent.x * extent.y, 1e-12);
+        m_cell            = std::sqrt(area * double(std::max<std::size_t>(per_cell, 1)) / double(nodes.size()));
+        m_cell            = std::max({m_cell, extent.x / 65536.0, extent.y / 65536.0, 1e-9});
+        m_origin          = box.min;
+        m_width           = static_cast<std::int64_t>(extent.x / m_cell) + 1;
+        m_height          = static_cast<std::int64_t>(extent.y / m_cell) + 1;
+
+        // Counting sort of the nodes by cell
+        m_offsets.assign(std::size_t(m_width * m_height) + 1, 0);
+        for (const auto& node : nodes)
+        {
+            ++m_offsets[cell_index(node.position) + 1];
+        }
+        for (std::size_t c = 1; c < m_offsets.size(); ++c)
+        {
+            m_offsets[c] += m_offsets[c - 1];
+        }
+
+        auto fill = m_offsets;
+        m_items.resize(nodes.size());
+        for (std::uint32_t i = 0; i < nodes.size(); ++i)
+        {
+            m_items[fill[cell_index(nodes[i].position)]++] = i;
+        }
+    }
+
+    double cell_size() const noexcept { return m_cell; }
+
+    std::int64_t rings() const noexcept { return std::max(m_width, m_height); }
+
+    // Visit the nodes of all cells at Chebyshev distance ring from the cell of a position
+    template<typename Fn>
+    void visit_ring(const Vector2D& position, std::int64_t ring, Fn&& fn) const
+    {
+        const auto cx = column(position);
+        const auto cy = row(position);
+        for (auto y = cy - ring; y <= cy + ring; ++y)
+        {
+            if (y < 0 || y >= m_height)
+            {
+                continue;
+            }
+
+            // Interior rows of the ring only have their two end cells on it
+            const auto step = (y == cy - ring || y == cy + ring) ? 1 : std::max<std::int64_t>(2 * ring, 1);
+            for (auto x = cx - ring; x <= cx + ring; x += step)
+            {
+                if (x < 0 || x >= m_width)
+                {
+                    continue;
+                }
+
+                const auto c = std::size_t(y * m_width + x);
+                for (auto i = m_offsets[c]; i < m_offsets[c + 1]; ++i)
+                {
+                    fn(m_items[i]);
+                }
+            }
+        }
+    }
+
+    private:
+    std::int64_t column(const Vector2D& p) const noexcept
+    {
+        return std::clamp<std::int64_t>(static_cast<std::int64_t>((p.x - m_origin.x) / m_cell), 0, m_width - 1);
+    }
+
+    std::int64_t row(const Vector2D& p) const noexcept
+    {
+        return std::clamp<std::int64_t>(static_cast<std::int64_t>((p.y - m_origin.y) / m_cell), 0, m_height - 1);
+    }
+
+    std::size_t cell_index(const Vector2D& p) const noexcept { return std::size_t(row(p) * m_width + column(p)); }
+
+    Vector2D                   m_origin{0.0, 0.0};
+    double                     m_cell{1.0};
+    std::int64_t               m_width{0};
+    std::int64_t               m_height{0};
+    std::vector<std::size_t>   m_offsets;
+    std::vector<std::uint32_t> m_items;
+};
+
+RoadmapEdge to_edge(std::uint32_t to, const PathDescriptor& path) noexcept
+{
+    RoadmapEdge edge;
+    edge.to       = to;
+    edge.word     = path.word;
+    edge.segments = {static_cast<float>(path.segments[0]), static_cast<float>(path.segments[1]),
+                     static_cast<float>(path.segments[2])};
+    return edge;
+}
+
+}    // namespace
+
+bool collides(const PathDescriptor& path, const std::vector<Circle>& obstacles) noexcept
+{
+    const auto box = bounds(path);
+    for (const auto& obstacle : obstacles)
+    {
+        if (overlaps(box, bounds(obstacle)) && project(path, obstacle.center).distance < obstacle.radius)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+Roadmap::Roadmap(const Options& options, const std::vector<Circle>& obstacles) : m_options{options}
+{
+    std::mt19937                           gen(options.seed);
+    std::uniform_real_distribution<double> x(options.region.min.x, options.region.max.x);
+    std::uniform_real_distribution<double> y(options.region.min.y, options.region.max.y);
+    std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+
+    // Rejection sampling, bounded in case the obstacles cover the region
+    m_nodes.reserve(options.nodes);
+    for (std::size_t attempt = 0; m_nodes.size() < options.nodes && attempt < 100 * options.nodes; ++attempt)
+    {
+        const State state{{x(gen), y(gen)}, heading(gen)};
+        const auto  blocked = std::any_of(obstacles.begin(), obstacles.end(), [&](const Circle& obstacle) {
+            return norm_sq(state.position - obstacle.center) < obstacle.radius * obstacle.radius;
+        });
+        if (!blocked)
+        {
+            m_nodes.push_back(state);
+        }
+    }
+
+    connect(obstacles);
+}
+
+Roadmap::Roadmap(std::vector<State> nodes, const Options& options, const std::vector<Circle>& obstacles)
+    : m_options{options}, m_nodes{std::move(nodes)}
+{
+    connect(obstacles);
+}
+
+void Roadmap::connect(const std::vector<Circle>& obstacles)
+{
+    const auto n = m_nodes.size();
+    const auto k = std::min(m_options.neighbours, n > 0 ? n - 1 : 0);
+    const auto r = m_options.turning_radius;
+
+    // Each node fills its own k slots, compacted into CSR afterwards
+    std::vector<RoadmapEdge>   slots(n * k);
+    std::vector<std::uint32_t> counts(n, 0);
+    const NodeGrid             grid{m_nodes, k};
+
+    detail::parallel_for(n, m_options.threads, [&](std::size_t begin, std::size_t end) {
+        using Candidate = std::pair<double, std::uint32_t>;
+
+        std::vector<Candidate>     heap;
+        std::vector<std::uint32_t> ring_nodes;
+        std::vector<State>         goals;
+        std::vector<double>        lengths;
+
+        for (auto i = begin; i < end; ++i)
+        {
+            const auto& from = m_nodes[i];
+            heap.clear();
+
+            for (std::int64_t ring = 0; ring <= grid.rings(); ++ring)
+            {
+                ring_nodes.clear();
+                goals.clear();
+                grid.visit_ring(from.position, ring, [&](std::uint32_t j) {
+                    if (j != i)
+                    {
+                        ring_nodes.push_back(j);
+                        goals.push_back(m_nodes[j]);
+                    }
+                });
+
+                one_to_many(from, goals, r, lengths);
+                for (std::size_t c = 0; c < ring_nodes.size(); ++c)
+                {
+                    const Candidate candidate{lengths[c], ring_nodes[c]};
+                    if (candidate.first > m_options.max_length
+                        || (heap.size() == k && !(candidate < heap.front())))
+                    {
+                        continue;
+                    }
+                    if (heap.size() == k)
+                    {
+                        std::pop_heap(heap.begin(), heap.end());
+                        heap.pop_back();
+                    }
+                    heap.push_back(candidate);
+                    std::push_heap(heap.begin(), heap.end());
+                }
+
+                // Nodes beyond this ring are at least this far away in a straight line, and no path is shorter
+                const auto reach = double(ring) * grid.cell_size();
+                if ((heap.size() == k && heap.front().first <= reach) || reach > m_options.max_length)
+                {
+                    break;
+                }
+            }
+
+            std::sort_heap(heap.begin(), heap.end());
+            for (const auto& [len, j] : heap)
+            {
+                const auto path = shortest_path(from, m_nodes[j], r);
+                if (!collides(path, obstacles))
+                {
+                    slots[i * k + counts[i]++] = to_edge(j, path);
+                }
+            }
+        }
+    });
+
+    m_offsets.assign(n + 1, 0);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        m_offsets[i + 1] = m_offsets[i] + counts[i];
+    }
+
+    m_edges.resize(m_offsets[n]);
+    detail::parallel_for(n, m_options.threads, [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i)
+        {
+            std::copy_n(slots.begin() + std::ptrdiff_t(i * k), counts[i],
+                        m_edges.begin() + std::ptrdiff_t(m_offsets[i]));
+        }
+    });
+}
+
+RoadmapPath Roadmap::query(std::uint32_t start, std::uint32_t goal) const
+{
+    RoadmapPath route;
+    if (start >= m_nodes.size() || goal >= m_nodes.size())
+    {
+        return route;
+    }
+
+    const auto r      = m_options.turning_radius;
+    const auto target = turning_circles(m_nodes[goal], r);
+    const auto h      = [&](std::uint32_t node) {
+        return node == goal ? 0.0 : length(shortest_path(turning_circles(m_nodes[node], r), target));
+    };
+
+    using Entry = std::pair<double, std::uint32_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+
+    std::vector<double>        cost(m_nodes.size(), std::numeric_limits<double>::infinity());
+    std::vector<std::uint32_t> parent(m_nodes.size(), no_node);
+    std::vector<bool>          closed(m_nodes.size(), false);
+
+    cost[start] = 0.0;
+    open.push({h(start), start});
+
+    while (!open.empty())
+    {
+        const auto node = open.top().second;
+        open.pop();
+
+        if (closed[node])
+        {
+            continue;
+        }
+        closed[node] = true;
+
+        if (node == goal)
+        {
+            break;
+        }
+
+        const auto [first, last] = edges(node);
+        for (auto edge = first; edge != last; ++edge)
+        {
+            const auto g = cost[node] + edge->length();
+            if (g < cost[edge->to])
+            {
+                cost[edge->to]   = g;
+                parent[edge->to] = node;
+                open.push({g + h(edge->to), edge->to});
+            }
+        }
+    }
+
+    if (!closed[goal])
+    {
+        return route;
+    }
+
+    for (auto node = goal; node != no_node; node = parent[node])
+    {
+        route.nodes.push_back(node);
+    }
+    std::reverse(route.nodes.begin(), route.nodes.end());
+    route.length = cost[goal];
+    return route;
+}
+
+std::vector<PathDescriptor> Roadmap::paths(const RoadmapPath& route) const
+{
+    std::vector<PathDescriptor> result;
+    for (std::size_t i = 1; i < route.nodes.size(); ++i)
+    {
+        // Parallel edges can not occur, so the edge to the next node is unique
+        const auto [first, last] = edges(route.nodes[i - 1]);
+        const auto edge = std::find_if(first, last, [&](const RoadmapEdge& e) { return e.to == route.nodes[i]; });
+        if (edge != last)
+        {
+            result.push_back(path(route.nodes[i - 1], *edge));
+        }
+    }
+    return result;
+}
+
+PathDescriptor Roadmap::path(std::uint32_t from, const RoadmapEdge& edge) const noexcept
+{
+    PathDescriptor result;
+    result.start    = m_nodes[from];
+    result.radius   = m_options.turning_radius;
+    result.word     = edge.word;
+    result.segments = {double(edge.segments[0]), double(edge.segments[1]), double(edge.segments[2])};
+    return result;
+}
+
+std::pair<const RoadmapEdge*, const RoadmapEdge*> Roadmap::edges(std::uint32_t node) const noexcept
+{
+    const auto* data = m_edges.data();
+    return {data + m_offsets[node], data + m_offsets[std::size_t(node) + 1]};
+}
+
+const State& Roadmap::node(std::uint32_t node) const noexcept
+{
+    return m_nodes[node];
+}
+
+std::size_t Roadmap::size() const noexcept
+{
+    return m_nodes.size();
+}
+
+std::size_t Roadmap::edge_count() const noexcept
+{
+    return m_edges.size();
+}
+
+const Roadmap::Options& Roadmap::options() const noexcept
+{
+    return m_options;
+}
+
+}    // namespace dubins
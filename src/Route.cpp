@@ -0,0 +1,149 @@
+#include "dubins/Route.hpp"
+#include "dubins/PathDescriptor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory_resource>
+#include <vector>
+
+namespace dubins
+{
+DubinsRoute::DubinsRoute(const std::vector<State>& waypoints, const Dubins::Options& options)
+{
+    rebuild(waypoints, options);
+}
+
+void DubinsRoute::rebuild(const std::vector<State>& waypoints, const Dubins::Options& options)
+{
+    m_legs.clear();
+    m_offsets.assign(1, 0.0);
+
+    if (waypoints.size() < 2)
+    {
+        return;
+    }
+
+    m_legs.reserve(waypoints.size() - 1);
+    m_offsets.reserve(waypoints.size());
+
+    for (std::size_t i = 0; i + 1 < waypoints.size(); ++i)
+    {
+        m_legs.push_back(shortest_path(waypoints[i], waypoints[i + 1], options.turning_radius));
+        m_offsets.push_back(m_offsets.back() + dubins::length(m_legs.back()));
+    }
+}
+
+double DubinsRoute::length() const noexcept
+{
+    return m_offsets.back();
+}
+
+std::size_t DubinsRoute::size() const noexcept
+{
+    return m_legs.size();
+}
+
+const PathDescriptor& DubinsRoute::leg(std::size_t idx) const noexcept
+{
+    return m_legs[idx];
+}
+
+double DubinsRoute::leg_offset(std::size_t idx) const noexcept
+{
+    return m_offsets[idx];
+}
+
+std::size_t DubinsRoute::leg_index(double distance) const noexcept
+{
+    if (m_legs.empty())
+    {
+        return 0;
+    }
+
+    // First offset strictly after the distance, the leg is the one before it
+    const auto it = std::upper_bound(m_offsets.begin() + 1, m_offsets.end() - 1, distance);
+    return static_cast<std::size_t>(it - (m_offsets.begin() + 1));
+}
+
+State DubinsRoute::state_at(double distance) const noexcept
+{
+    if (m_legs.empty())
+    {
+        return {};
+    }
+
+    const auto idx = leg_index(distance);
+    return dubins::state_at(m_legs[idx], distance - m_offsets[idx]);
+}
+
+std::vector<State> DubinsRoute::segmented_path(const Dubins::Options& options) const
+{
+    std::vector<State> segments;
+    segmented_path_impl(options, segments);
+    return segments;
+}
+
+std::pmr::vector<State> DubinsRoute::segmented_path(const Dubins::Options&        options,
+                                                    std::pmr::memory_resource* resource) const
+{
+    std::pmr::vector<State> segments{resource};
+    segmented_path_impl(options, segments);
+    return segments;
+}
+
+std::vector<State> DubinsRoute::adaptive_path(double max_chord_error) const
+{
+    std::vector<State> states;
+    if (m_legs.empty() || !(max_chord_error > 0.0))
+    {
+        return states;
+    }
+
+    states.push_back(dubins::state_at(m_legs.front(), 0.0));
+    for (const auto& leg : m_legs)
+    {
+        sample_adaptive(leg, max_chord_error, states);
+    }
+    return states;
+}
+
+template<typename Segments>
+void DubinsRoute::segmented_path_impl(const Dubins::Options& options, Segments& segments) const
+{
+    if (m_legs.empty())
+    {
+        return;
+    }
+
+    const auto total          = length();
+    const auto num_segments   = std::max(double(options.min_number_of_segments),
+                                         std::ceil(total / options.max_segment_length));
+    const auto count          = static_cast<std::size_t>(num_segments);
+    const auto segment_length = total / num_segments;
+
+    // Every waypoint coincides, there is no spacing to place the points by
+    if (total <= 0.0)
+    {
+        segments.insert(segments.end(), count + 1, dubins::state_at(m_legs.front(), 0.0));
+        return;
+    }
+
+    segments.reserve(count + 1);
+
+    // Point k lies at k * segment_length. Hand each leg the points that fall inside it.
+    std::size_t k = 0;
+    for (std::size_t i = 0; i < m_legs.size(); ++i)
+    {
+        const auto boundary = static_cast<std::size_t>(std::floor(m_offsets[i + 1] / segment_length));
+        const auto last     = (i + 1 == m_legs.size()) ? count : std::min(count, boundary);
+
+        if (last + 1 > k)
+        {
+            const auto first = double(k) * segment_length - m_offsets[i];
+            sample(m_legs[i], first, segment_length, last + 1 - k, segments);
+            k = last + 1;
+        }
+    }
+}
+
+}    // namespace dubins
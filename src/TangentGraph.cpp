@@ -0,0 +1,413 @@
+#include "dubins/TangentGraph.hpp"
+#include "dubins/Angle.hpp"
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Trig.hpp"
+
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <unordered_set>
+
+namespace dubins
+{
+namespace
+{
+constexpr std::size_t no_obstacle = std::numeric_limits<std::size_t>::max();
+
+// Tangents that only graze an obstacle are not blocked
+constexpr double graze_tolerance = 1e-9;
+
+std::optional<Line2D> tangent(const Circle& a, bool a_left, const Circle& b, bool b_left) noexcept
+{
+    if (a_left)
+    {
+        return b_left ? calculate_transfer_line(CircleCCW{a}, CircleCCW{b})
+                      : calculate_transfer_line(CircleCCW{a}, CircleCW{b});
+    }
+    return b_left ? calculate_transfer_line(CircleCW{a}, CircleCCW{b})
+                  : calculate_transfer_line(CircleCW{a}, CircleCW{b});
+}
+
+// Signed angle travelled around a circle from one angle to another in its direction of travel
+double sweep(double from, double to, bool left) noexcept
+{
+    return left ? Angle::positive_difference(Angle{to}, Angle{from})
+                : Angle::negative_difference(Angle{to}, Angle{from});
+}
+
+double distance(const Line2D& line, const Vector2D& point) noexcept
+{
+    const auto d   = line.b - line.a;
+    const auto len = norm_sq(d);
+    const auto t   = len > 0.0 ? std::clamp(inner(point - line.a, d) / len, 0.0, 1.0) : 0.0;
+    return norm(point - (line.a + t * d));
+}
+
+double distance(const ArcPrimitive& arc, const Vector2D& point) noexcept
+{
+    const auto v     = point - arc.center;
+    const auto phi   = angle_of(v);
+    const auto along = arc.sweep >= 0.0 ? Angle::positive_difference(Angle{phi}, Angle{arc.start_angle})
+                                        : -Angle::negative_difference(Angle{phi}, Angle{arc.start_angle});
+    if (along <= std::abs(arc.sweep))
+    {
+        return std::abs(norm(v) - arc.radius);
+    }
+
+    const auto first = arc.center + arc.radius * unit_vector(arc.start_angle);
+    const auto last  = arc.center + arc.radius * unit_vector(arc.end_angle);
+    return std::min(norm(point - first), norm(point - last));
+}
+
+ArcPrimitive make_arc(const Circle& circle, bool left, double from, double to) noexcept
+{
+    ArcPrimitive arc;
+    arc.center      = circle.center;
+    arc.radius      = circle.radius;
+    arc.start_angle = double(Angle{from});
+    arc.end_angle   = double(Angle{to});
+    arc.sweep       = sweep(from, to, left);
+    arc.direction   = left ? SegmentType::left : SegmentType::right;
+    return arc;
+}
+
+}    // namespace
+
+TangentGraph::TangentGraph(std::vector<Circle> obstacles, const Options& options)
+    : m_options{options}, m_obstacles{std::move(obstacles)}
+{
+    const auto n = m_obstacles.size();
+    m_boxes.min_x.resize(n);
+    m_boxes.min_y.resize(n);
+    m_boxes.max_x.resize(n);
+    m_boxes.max_y.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const auto box   = bounds(Circle{m_obstacles[i].center, m_obstacles[i].radius + options.clearance});
+        m_boxes.min_x[i] = box.min.x;
+        m_boxes.min_y[i] = box.min.y;
+        m_boxes.max_x[i] = box.max.x;
+        m_boxes.max_y[i] = box.max.y;
+    }
+
+    m_edges.resize(2 * n);
+    detail::parallel_for(2 * n, options.threads, [&](std::size_t begin, std::size_t end) {
+        for (auto node = begin; node < end; ++node)
+        {
+            connect(node);
+        }
+    });
+}
+
+void TangentGraph::move(std::size_t obstacle, const Circle& circle)
+{
+    const auto& previous = m_obstacles[obstacle];
+    const auto  old_box  = bounds(Circle{previous.center, previous.radius + m_options.clearance});
+    const auto  new_box  = bounds(Circle{circle.center, circle.radius + m_options.clearance});
+
+    m_obstacles[obstacle]   = circle;
+    m_boxes.min_x[obstacle] = new_box.min.x;
+    m_boxes.min_y[obstacle] = new_box.min.y;
+    m_boxes.max_x[obstacle] = new_box.max.x;
+    m_boxes.max_y[obstacle] = new_box.max.y;
+
+    detail::parallel_for(m_edges.size(), m_options.threads, [&](std::size_t begin, std::size_t end) {
+        for (auto node = begin; node < end; ++node)
+        {
+            if (node / 2 == obstacle)
+            {
+                connect(node);
+                continue;
+            }
+
+            const auto from = travel_circle(node);
+            for (auto& edge : m_edges[node])
+            {
+                if (edge.to / 2 == obstacle)
+                {
+                    // The tangent itself moved
+                    const auto line = tangent(from, node % 2 == 0, travel_circle(edge.to), edge.to % 2 == 0);
+                    edge.exists     = line.has_value();
+                    edge.blocked    = !line || blocked(*line, node / 2, obstacle);
+                    if (line)
+                    {
+                        edge.line   = *line;
+                        edge.depart = angle_of(line->a - from.center);
+                        edge.arrive = angle_of(line->b - travel_circle(edge.to).center);
+                    }
+                    continue;
+                }
+
+                // Only tangents near the old or new position can change state
+                const auto box = dubins::bounds(edge.line);
+                if (edge.exists && (overlaps(box, old_box) || overlaps(box, new_box)))
+                {
+                    edge.blocked = blocked(edge.line, node / 2, edge.to / 2);
+                }
+            }
+        }
+    });
+}
+
+std::optional<TangentPath> TangentGraph::plan(const State& start, const State& goal) const
+{
+    const auto r     = m_options.turning_radius;
+    const auto nodes = m_edges.size();
+
+    // Query circles follow the obstacle circles: start left, start right, goal left, goal right
+    const auto from_start = turning_circles(start, r);
+    const auto to_goal    = turning_circles(goal, r);
+    const auto circle     = [&](std::size_t node) -> Circle {
+        switch (node - nodes)
+        {
+            case 0: return from_start.left;
+            case 1: return from_start.right;
+            case 2: return to_goal.left;
+            case 3: return to_goal.right;
+            default: return travel_circle(node);
+        }
+    };
+    const auto left     = [](std::size_t node) { return node % 2 == 0; };
+    const auto obstacle = [&](std::size_t node) { return node < nodes ? node / 2 : no_obstacle; };
+    const auto is_goal  = [&](std::size_t node) { return node >= nodes + 2; };
+
+    const auto arc_free = [&](const ArcPrimitive& arc) {
+        std::vector<std::size_t> candidates;
+        overlapping(m_boxes, dubins::bounds(arc), candidates);
+        return std::none_of(candidates.begin(), candidates.end(), [&](std::size_t i) {
+            return distance(arc, m_obstacles[i].center) < m_obstacles[i].radius + m_options.clearance - graze_tolerance;
+        });
+    };
+
+    const auto start_angle = [&](std::size_t node) { return angle_of(start.position - circle(node).center); };
+    const auto goal_angle  = [&](std::size_t node) { return angle_of(goal.position - circle(node).center); };
+
+    // A step of the search: the tangent from one circle to the next, or the final arc onto the goal when to == final
+    struct Record
+    {
+        std::size_t  from;
+        std::size_t  to;
+        Line2D       line;
+        double       depart;
+        double       arrive;
+        std::int64_t parent;
+    };
+    const auto final = nodes + 4;
+
+    std::vector<Record> records;
+    using Entry = std::pair<double, std::int64_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+    std::unordered_set<std::uint64_t>                                   settled;
+
+    const auto query_edge = [&](std::size_t from, std::size_t to) -> std::optional<Edge> {
+        const auto a    = circle(from);
+        const auto b    = circle(to);
+        const auto line = tangent(a, left(from), b, left(to));
+        if (!line || blocked(*line, obstacle(from), obstacle(to)))
+        {
+            return std::nullopt;
+        }
+        return Edge{static_cast<std::uint32_t>(to), *line, angle_of(line->a - a.center), angle_of(line->b - b.center),
+                    true, false};
+    };
+
+    const auto push = [&](double cost, std::size_t from, const Edge& edge, std::int64_t parent) {
+        records.push_back({from, edge.to, edge.line, edge.depart, edge.arrive, parent});
+        open.push({cost + norm(edge.line.b - edge.line.a), static_cast<std::int64_t>(records.size() - 1)});
+    };
+
+    for (const auto s : {nodes, nodes + 1})
+    {
+        for (std::size_t to = 0; to < nodes + 4; ++to)
+        {
+            if (to == nodes || to == nodes + 1)
+            {
+                continue;
+            }
+
+            const auto edge = query_edge(s, to);
+            if (!edge)
+            {
+                continue;
+            }
+
+            const auto arc = make_arc(circle(s), left(s), start_angle(s), edge->depart);
+            if (arc_free(arc))
+            {
+                push(length(arc), s, *edge, -1);
+            }
+        }
+    }
+
+    std::optional<TangentPath> result;
+    while (!open.empty())
+    {
+        const auto [cost, id] = open.top();
+        open.pop();
+
+        const auto record = records[std::size_t(id)];
+        if (!settled.insert(std::uint64_t(record.from) * (final + 1) + record.to).second)
+        {
+            continue;
+        }
+
+        if (record.to == final)
+        {
+            // Walk back through the records, each contributes its tangent and the arc leading into it
+            TangentPath path;
+            path.length = cost;
+
+            auto current = record.parent;
+            auto arrive  = records[std::size_t(current)].arrive;
+            auto node    = records[std::size_t(current)].to;
+            path.primitives.push_back(make_arc(circle(node), left(node), arrive, goal_angle(node)));
+
+            for (; current >= 0; current = records[std::size_t(current)].parent)
+            {
+                const auto& step = records[std::size_t(current)];
+                path.primitives.push_back(step.line);
+
+                const auto before = step.parent >= 0 ? records[std::size_t(step.parent)].arrive
+                                                     : start_angle(step.from);
+                path.primitives.push_back(make_arc(circle(step.from), left(step.from), before, step.depart));
+            }
+
+            std::reverse(path.primitives.begin(), path.primitives.end());
+            result = std::move(path);
+            break;
+        }
+
+        const auto node = record.to;
+        if (is_goal(node))
+        {
+            const auto arc = make_arc(circle(node), left(node), record.arrive, goal_angle(node));
+            if (arc_free(arc))
+            {
+                records.push_back({node, final, {}, 0.0, 0.0, id});
+                open.push({cost + length(arc), static_cast<std::int64_t>(records.size() - 1)});
+            }
+            continue;
+        }
+
+        const auto around = [&](double depart) {
+            return circle(node).radius * std::abs(sweep(record.arrive, depart, left(node)));
+        };
+
+        for (const auto& edge : m_edges[node])
+        {
+            if (!edge.blocked)
+            {
+                push(cost + around(edge.depart), node, edge, id);
+            }
+        }
+        for (const auto g : {nodes + 2, nodes + 3})
+        {
+            if (const auto edge = query_edge(node, g))
+            {
+                push(cost + around(edge->depart), node, *edge, id);
+            }
+        }
+    }
+
+    return result;
+}
+
+const std::vector<Circle>& TangentGraph::obstacles() const noexcept
+{
+    return m_obstacles;
+}
+
+std::size_t TangentGraph::edge_count() const noexcept
+{
+    std::size_t count = 0;
+    for (const auto& edges : m_edges)
+    {
+        count += std::size_t(std::count_if(edges.begin(), edges.end(), [](const Edge& e) { return !e.blocked; }));
+    }
+    return count;
+}
+
+const TangentGraph::Options& TangentGraph::options() const noexcept
+{
+    return m_options;
+}
+
+Circle TangentGraph::travel_circle(std::size_t node) const noexcept
+{
+    const auto& obstacle = m_obstacles[node / 2];
+    return {obstacle.center, std::max(obstacle.radius + m_options.clearance, m_options.turning_radius)};
+}
+
+void TangentGraph::connect(std::size_t node)
+{
+    const auto from = travel_circle(node);
+    const auto n    = m_obstacles.size();
+
+    // Tangents to every obstacle in both directions, solved as a batch
+    Circles sources;
+    Circles targets;
+    sources.resize(n);
+    targets.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const auto target = travel_circle(2 * i);
+        sources.x[i]      = from.center.x;
+        sources.y[i]      = from.center.y;
+        sources.radius[i] = from.radius;
+        targets.x[i]      = target.center.x;
+        targets.y[i]      = target.center.y;
+        targets.radius[i] = target.radius;
+    }
+
+    const auto                rotation = node % 2 == 0 ? Rotation::ccw : Rotation::cw;
+    Lines                     lines[2];
+    std::vector<std::uint8_t> valid[2];
+    calculate_transfer_lines(sources, rotation, targets, Rotation::ccw, lines[0], valid[0]);
+    calculate_transfer_lines(sources, rotation, targets, Rotation::cw, lines[1], valid[1]);
+
+    auto& edges = m_edges[node];
+    edges.clear();
+    for (std::size_t to = 0; to < m_edges.size(); ++to)
+    {
+        const auto i = to / 2;
+        const auto k = to % 2;
+        if (i == node / 2)
+        {
+            continue;
+        }
+
+        // Every pair keeps its slot, circles without a tangent are stored as blocked
+        Edge edge;
+        edge.to      = static_cast<std::uint32_t>(to);
+        edge.exists  = valid[k][i] != 0;
+        edge.blocked = true;
+        if (edge.exists)
+        {
+            edge.line    = {{lines[k].ax[i], lines[k].ay[i]}, {lines[k].bx[i], lines[k].by[i]}};
+            edge.depart  = angle_of(edge.line.a - from.center);
+            edge.arrive  = angle_of(edge.line.b - Vector2D{targets.x[i], targets.y[i]});
+            edge.blocked = blocked(edge.line, node / 2, i);
+        }
+        edges.push_back(edge);
+    }
+}
+
+bool TangentGraph::blocked(const Line2D& line, std::size_t skip_a, std::size_t skip_b) const
+{
+    std::vector<std::size_t> candidates;
+    overlapping(m_boxes, dubins::bounds(line), candidates);
+    for (const auto i : candidates)
+    {
+        if (i != skip_a && i != skip_b
+            && distance(line, m_obstacles[i].center) < m_obstacles[i].radius + m_options.clearance - graze_tolerance)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+}    // namespace dubins
@@ -0,0 +1,26 @@
+#include "dubins/Trig.hpp"
+
+#include <atomic>
+
+namespace dubins
+{
+namespace
+{
+#ifdef DUBINS_FAST_TRIG
+std::atomic<TrigMode> g_trig_mode{TrigMode::approximate};
+#else
+std::atomic<TrigMode> g_trig_mode{TrigMode::exact};
+#endif
+}    // namespace
+
+void set_trig_mode(TrigMode mode) noexcept
+{
+    g_trig_mode.store(mode, std::memory_order_relaxed);
+}
+
+TrigMode trig_mode() noexcept
+{
+    return g_trig_mode.load(std::memory_order_relaxed);
+}
+
+}    // namespace dubins
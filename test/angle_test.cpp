@@ -202,4 +202,73 @@ TEST(AngleTest, negative_difference)
 
         EXPECT_DOUBLE_EQ(r, -3.0*M_PI_2);
     }
-}
\ No newline at end of file
+}
+
+TEST(AngleTest, wrapping_edge_cases)
+{
+    using namespace dubins;
+
+    // Negative zero and tiny negative values must not wrap to 2pi
+    {
+        Angle a{-0.0};
+        EXPECT_EQ((double)a, 0.0);
+        EXPECT_FALSE(std::signbit((double)a));
+    }
+    {
+        Angle a{-1.0e-300};
+        EXPECT_GE((double)a, 0.0);
+        EXPECT_LT((double)a, 2.0 * M_PI);
+    }
+    {
+        Angle a{-1.0e-17};
+        EXPECT_GE((double)a, 0.0);
+        EXPECT_LT((double)a, 2.0 * M_PI);
+    }
+    // Values just below 2pi stay below 2pi
+    {
+        Angle a{std::nextafter(2.0 * M_PI, 0.0)};
+        EXPECT_LT((double)a, 2.0 * M_PI);
+    }
+    // Non-finite values propagate as NaN
+    {
+        Angle a{std::nan("")};
+        EXPECT_TRUE(std::isnan((double)a));
+    }
+    {
+        Angle a{INFINITY};
+        EXPECT_TRUE(std::isnan((double)a));
+    }
+    // Large arguments agree with fmod
+    for (double angle = -1.0e6; angle < 1.0e6; angle += 1234.567)
+    {
+        Angle      a{angle};
+        const auto expected = std::fmod(2.0 * M_PI + std::fmod(angle, 2.0 * M_PI), 2.0 * M_PI);
+
+        EXPECT_GE((double)a, 0.0);
+        EXPECT_LT((double)a, 2.0 * M_PI);
+        EXPECT_NEAR(Angle::signed_difference(a, Angle{expected}), 0.0, 1e-12);
+    }
+}
+
+TEST(AngleTest, signed_difference_range)
+{
+    using namespace dubins;
+
+    // The difference is always in [-pi, pi), an exact half turn maps to -pi
+    EXPECT_DOUBLE_EQ(Angle::signed_difference(Angle{M_PI}, Angle{0.0}), -M_PI);
+    EXPECT_DOUBLE_EQ(Angle::signed_difference(Angle{0.0}, Angle{M_PI}), -M_PI);
+
+    for (double a = -10.0; a < 10.0; a += 0.0731)
+    {
+        for (double b = -10.0; b < 10.0; b += 0.0917)
+        {
+            const auto r        = Angle::signed_difference(Angle{a}, Angle{b});
+            const auto expected = std::fmod(std::fmod(a - b, 2.0 * M_PI) + 3.0 * M_PI, 2.0 * M_PI) - M_PI;
+
+            EXPECT_GE(r, -M_PI);
+            EXPECT_LT(r, M_PI);
+            EXPECT_NEAR(std::sin(r), std::sin(expected), 1e-12);
+            EXPECT_NEAR(std::cos(r), std::cos(expected), 1e-12);
+        }
+    }
+}
@@ -0,0 +1,137 @@
+#include "dubins/Anytime.hpp"
+#include "dubins/PathDescriptor.hpp"
+#include "random_inputs.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+
+TEST(AnytimeTest, lower_bound)
+{
+    using namespace dubins;
+
+    const auto starts = random_states(2000, 3);
+    const auto ends   = random_states(2000, 4);
+    for (std::size_t i = 0; i < starts.size(); ++i)
+    {
+        const auto bound = length_lower_bound(starts[i], ends[i], 1.3);
+        EXPECT_LE(bound, length(shortest_path(starts[i], ends[i], 1.3)) + 1e-12) << i;
+    }
+
+    // Turning on the spot needs a half circle at least
+    EXPECT_DOUBLE_EQ(length_lower_bound({{0.0, 0.0}, 0.0}, {{0.0, 0.0}, M_PI}, 2.0), 2.0 * M_PI);
+    EXPECT_DOUBLE_EQ(length_lower_bound({{0.0, 0.0}, 0.0}, {{3.0, 4.0}, 0.0}, 2.0), 5.0);
+}
+
+TEST(AnytimeTest, complete_batch)
+{
+    using namespace dubins;
+
+    const auto starts = random_states(300, 5);
+    const auto ends   = random_states(300, 6);
+
+    AnytimeBatch::Options options;
+    options.chunk = 16;
+    AnytimeBatch batch(starts, ends, 1.1, {}, options);
+    EXPECT_FALSE(batch.done());
+    EXPECT_TRUE(batch.run());
+    EXPECT_TRUE(batch.done());
+    ASSERT_EQ(batch.size(), starts.size());
+
+    for (std::size_t i = 0; i < starts.size(); ++i)
+    {
+        const auto expected = shortest_path(starts[i], ends[i], 1.1);
+        EXPECT_EQ(batch.completed()[i], completion::bound | completion::length | completion::samples);
+        EXPECT_LE(batch.lower_bounds()[i], length(expected) + 1e-12);
+        EXPECT_DOUBLE_EQ(length(batch.paths()[i]), length(expected));
+
+        const auto& samples = batch.samples()[i];
+        ASSERT_GE(samples.size(), 2u);
+        EXPECT_NEAR(samples.back().position.x, ends[i].position.x, 1e-9);
+        EXPECT_NEAR(samples.back().position.y, ends[i].position.y, 1e-9);
+    }
+}
+
+TEST(AnytimeTest, deadline_and_cancel)
+{
+    using namespace dubins;
+
+    const auto starts = random_states(100, 7);
+    const auto ends   = random_states(100, 8);
+
+    AnytimeBatch::Options options;
+    options.chunk  = 10;
+    options.sample = false;
+    AnytimeBatch batch(starts, ends, 1.0, {}, options);
+
+    // A deadline that has passed, or a cancelled run, does no work
+    EXPECT_FALSE(batch.run(AnytimeBatch::Clock::now() - std::chrono::seconds(1)));
+    std::atomic<bool> cancel{true};
+    EXPECT_FALSE(batch.run_for(std::chrono::seconds(10), &cancel));
+    for (const auto bits : batch.completed())
+    {
+        EXPECT_EQ(bits, 0);
+    }
+
+    // Without sampling, bounds and lengths complete everything
+    cancel = false;
+    EXPECT_TRUE(batch.run_for(std::chrono::seconds(10), &cancel));
+    for (const auto bits : batch.completed())
+    {
+        EXPECT_EQ(bits, completion::bound | completion::length);
+    }
+}
+
+TEST(AnytimeTest, partial_results_follow_priority)
+{
+    using namespace dubins;
+
+    const auto          starts = random_states(256, 9);
+    const auto          ends   = random_states(256, 10);
+    std::vector<double> priorities(starts.size());
+    for (std::size_t i = 0; i < priorities.size(); ++i)
+    {
+        priorities[i] = static_cast<double>((i * 37) % starts.size());
+    }
+
+    AnytimeBatch::Options options;
+    options.chunk = 4;
+    AnytimeBatch batch(starts, ends, 1.0, priorities, options);
+
+    // Wherever a slice stops, every bound is filled before any length, every length before any samples, and each
+    // stage has reached exactly the queries of highest priority
+    std::size_t slices = 0;
+    while (!batch.run_for(std::chrono::microseconds(50)) && slices < 100000)
+    {
+        ++slices;
+
+        const auto& completed = batch.completed();
+        for (const auto bit : {completion::bound, completion::length, completion::samples})
+        {
+            double lowest_done    = std::numeric_limits<double>::infinity();
+            double highest_undone = -std::numeric_limits<double>::infinity();
+            for (std::size_t i = 0; i < completed.size(); ++i)
+            {
+                if (completed[i] & bit)
+                {
+                    lowest_done = std::min(lowest_done, priorities[i]);
+                }
+                else
+                {
+                    highest_undone = std::max(highest_undone, priorities[i]);
+                }
+            }
+            EXPECT_GT(lowest_done, highest_undone);
+        }
+        for (const auto bits : completed)
+        {
+            EXPECT_TRUE(!(bits & completion::length) || (bits & completion::bound));
+            EXPECT_TRUE(!(bits & completion::samples) || (bits & completion::length));
+        }
+    }
+    EXPECT_TRUE(batch.done());
+}
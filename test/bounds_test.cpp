@@ -0,0 +1,122 @@
+#include "dubins/Bounds.hpp"
+#include "dubins/PathDescriptor.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+
+TEST(BoundsTest, arc)
+{
+    using namespace dubins;
+
+    // Counter-clockwise from -pi/4 to pi/2 passes the +x extreme only
+    ArcPrimitive arc;
+    arc.center      = {1.0, 1.0};
+    arc.radius      = 2.0;
+    arc.start_angle = 7.0 * M_PI_4;
+    arc.sweep       = 3.0 * M_PI_4;
+    arc.direction   = SegmentType::left;
+
+    auto box = bounds(arc);
+    EXPECT_NEAR(box.max.x, 3.0, 1e-12);
+    EXPECT_NEAR(box.max.y, 3.0, 1e-12);
+    EXPECT_NEAR(box.min.x, 1.0, 1e-12);
+    EXPECT_NEAR(box.min.y, 1.0 - std::sqrt(2.0), 1e-12);
+
+    // Clockwise from pi/2 to -3pi/4 passes the +x and -y extremes
+    arc.start_angle = M_PI_2;
+    arc.sweep       = -5.0 * M_PI_4;
+    arc.direction   = SegmentType::right;
+
+    box = bounds(arc);
+    EXPECT_NEAR(box.max.x, 3.0, 1e-12);
+    EXPECT_NEAR(box.max.y, 3.0, 1e-12);
+    EXPECT_NEAR(box.min.x, 1.0 - std::sqrt(2.0), 1e-12);
+    EXPECT_NEAR(box.min.y, -1.0, 1e-12);
+}
+
+TEST(BoundsTest, circle)
+{
+    using namespace dubins;
+
+    const auto box = bounds(Circle{{1.0, -2.0}, 0.5});
+    EXPECT_EQ(box.min.x, 0.5);
+    EXPECT_EQ(box.min.y, -2.5);
+    EXPECT_EQ(box.max.x, 1.5);
+    EXPECT_EQ(box.max.y, -1.5);
+}
+
+TEST(BoundsTest, matches_sampled_path)
+{
+    using namespace dubins;
+
+    std::mt19937                           gen(7);
+    std::uniform_real_distribution<double> pos(-10.0, 10.0);
+    std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+
+    std::vector<PathDescriptor> paths;
+    for (int i = 0; i < 200; ++i)
+    {
+        paths.push_back(shortest_path({{pos(gen), pos(gen)}, heading(gen)}, {{pos(gen), pos(gen)}, heading(gen)}, 1.5));
+    }
+
+    BoundingBoxes boxes;
+    bounds(paths, boxes, 2);
+    ASSERT_EQ(boxes.size(), paths.size());
+
+    for (std::size_t i = 0; i < paths.size(); ++i)
+    {
+        // Sampled bounds are inside the exact bounds and converge to them
+        BoundingBox sampled;
+        const auto  len = length(paths[i]);
+        for (int k = 0; k <= 20000; ++k)
+        {
+            expand(sampled, state_at(paths[i], len * k / 20000.0).position);
+        }
+
+        const auto tol = 1e-4;
+        EXPECT_LE(boxes.min_x[i], sampled.min.x + 1e-9);
+        EXPECT_LE(boxes.min_y[i], sampled.min.y + 1e-9);
+        EXPECT_GE(boxes.max_x[i], sampled.max.x - 1e-9);
+        EXPECT_GE(boxes.max_y[i], sampled.max.y - 1e-9);
+        EXPECT_NEAR(boxes.min_x[i], sampled.min.x, tol);
+        EXPECT_NEAR(boxes.min_y[i], sampled.min.y, tol);
+        EXPECT_NEAR(boxes.max_x[i], sampled.max.x, tol);
+        EXPECT_NEAR(boxes.max_y[i], sampled.max.y, tol);
+    }
+}
+
+TEST(BoundsTest, overlapping)
+{
+    using namespace dubins;
+
+    std::vector<PathDescriptor> paths;
+    for (int i = 0; i < 150; ++i)
+    {
+        paths.push_back(shortest_path({{5.0 * i, 0.0}, 0.0}, {{5.0 * i + 3.0, 0.0}, 0.0}, 1.0));
+    }
+
+    BoundingBoxes boxes;
+    bounds(paths, boxes);
+
+    BoundingBox query;
+    expand(query, Vector2D{99.0, -1.0});
+    expand(query, Vector2D{106.0, 1.0});
+
+    std::vector<std::size_t> hits;
+    overlapping(boxes, query, hits);
+
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < paths.size(); ++i)
+    {
+        if (overlaps(bounds(paths[i]), query))
+        {
+            expected.push_back(i);
+        }
+    }
+
+    EXPECT_EQ(hits, expected);
+    EXPECT_EQ(hits, (std::vector<std::size_t>{20, 21}));
+}
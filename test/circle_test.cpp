@@ -1,9 +1,34 @@
 #include "dubins/Circle.hpp"
 #include "dubins/Vector.hpp"
+#include "random_inputs.hpp"
 
 #include <gtest/gtest.h>
+#include <random>
 
 
+namespace
+{
+dubins::Circle circle(const dubins::Circles& circles, std::size_t i)
+{
+    return {{circles.x[i], circles.y[i]}, circles.radius[i]};
+}
+
+// Scalar reference for a rotation pair
+std::optional<dubins::Line2D> transfer_line(const dubins::Circle& a, dubins::Rotation ra, const dubins::Circle& b,
+                                            dubins::Rotation rb)
+{
+    using namespace dubins;
+    if (ra == Rotation::cw)
+    {
+        return rb == Rotation::cw ? calculate_transfer_line(CircleCW{a}, CircleCW{b})
+                                  : calculate_transfer_line(CircleCW{a}, CircleCCW{b});
+    }
+    return rb == Rotation::cw ? calculate_transfer_line(CircleCCW{a}, CircleCW{b})
+                              : calculate_transfer_line(CircleCCW{a}, CircleCCW{b});
+}
+
+}    // namespace
+
 TEST(CircleTest, circle_cw_cw_tangent)
 {
     using namespace dubins;
@@ -212,4 +237,80 @@ TEST(CircleTest, circle_b_inside_a)
 
     b = Circle{{0.50001, 0.0}, 1.0};
     EXPECT_FALSE(inside(a, b));
-}
\ No newline at end of file
+}
+
+TEST(CircleTest, batch_transfer_lines)
+{
+    using namespace dubins;
+
+    std::mt19937 gen(3);
+    auto         a = random_circles(gen, 1001);
+    auto         b = random_circles(gen, 1001);
+
+    // Coincident, and touching from outside
+    a.x[0] = b.x[0] = a.y[0] = b.y[0] = 0.0;
+    a.x[1] = b.y[1] = a.y[1] = 0.0;
+    b.x[1]                   = a.radius[1] + b.radius[1];
+
+    Lines                     lines;
+    std::vector<std::uint8_t> valid;
+    for (const auto ra : {Rotation::cw, Rotation::ccw})
+    {
+        for (const auto rb : {Rotation::cw, Rotation::ccw})
+        {
+            calculate_transfer_lines(a, ra, b, rb, lines, valid);
+            ASSERT_EQ(lines.size(), a.size());
+            ASSERT_EQ(valid.size(), a.size());
+
+            for (std::size_t i = 0; i < a.size(); ++i)
+            {
+                const auto expected = transfer_line(circle(a, i), ra, circle(b, i), rb);
+                ASSERT_EQ(valid[i] != 0, expected.has_value()) << i;
+                if (expected)
+                {
+                    EXPECT_NEAR(lines.ax[i], expected->a.x, 1e-12);
+                    EXPECT_NEAR(lines.ay[i], expected->a.y, 1e-12);
+                    EXPECT_NEAR(lines.bx[i], expected->b.x, 1e-12);
+                    EXPECT_NEAR(lines.by[i], expected->b.y, 1e-12);
+                }
+            }
+        }
+    }
+}
+
+TEST(CircleTest, batch_transfer_circles)
+{
+    using namespace dubins;
+
+    std::mt19937 gen(5);
+    const auto   a = random_circles(gen, 1001);
+    const auto   b = random_circles(gen, 1001);
+
+    Circles                   circles;
+    std::vector<std::uint8_t> valid;
+    for (const auto rotation : {Rotation::cw, Rotation::ccw})
+    {
+        calculate_transfer_circles(a, b, rotation, 1.5, circles, valid);
+        ASSERT_EQ(circles.size(), a.size());
+
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            std::optional<Circle> expected;
+            if (rotation == Rotation::cw)
+            {
+                expected = calculate_transfer_circle(CircleCW{circle(a, i)}, CircleCW{circle(b, i)}, 1.5);
+            }
+            else
+            {
+                expected = calculate_transfer_circle(CircleCCW{circle(a, i)}, CircleCCW{circle(b, i)}, 1.5);
+            }
+            ASSERT_EQ(valid[i] != 0, expected.has_value()) << i;
+            if (expected)
+            {
+                EXPECT_NEAR(circles.x[i], expected->center.x, 1e-12);
+                EXPECT_NEAR(circles.y[i], expected->center.y, 1e-12);
+                EXPECT_EQ(circles.radius[i], 1.5);
+            }
+        }
+    }
+}
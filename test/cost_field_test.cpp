@@ -0,0 +1,113 @@
+#include "dubins/CostField.hpp"
+#include "dubins/PathDescriptor.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+
+
+namespace
+{
+dubins::CostField::Options field_options()
+{
+    dubins::CostField::Options opt;
+    opt.origin         = {-5.0, -5.0};
+    opt.resolution     = 0.5;
+    opt.width          = 21;
+    opt.height         = 21;
+    opt.headings       = 16;
+    opt.turning_radius = 1.0;
+    opt.threads        = 2;
+    return opt;
+}
+
+}    // namespace
+
+TEST(CostFieldTest, nodes_match_shortest_path)
+{
+    using namespace dubins;
+
+    const auto      opt = field_options();
+    const State     goal{{0.3, -0.2}, 0.7};
+    const CostField field{goal, opt};
+    ASSERT_FALSE(field.empty());
+
+    for (std::int32_t y = 0; y < opt.height; y += 3)
+    {
+        for (std::int32_t x = 0; x < opt.width; x += 3)
+        {
+            for (std::int32_t k = 0; k < opt.headings; ++k)
+            {
+                const State start{opt.origin + opt.resolution * Vector2D{double(x), double(y)},
+                                  2.0 * M_PI * k / opt.headings};
+                const auto  expected = length(shortest_path(start, goal, opt.turning_radius));
+
+                EXPECT_NEAR(field.at(x, y, k), expected, field.quantization_error() + 1e-12);
+                EXPECT_NEAR(field.lookup(start), field.at(x, y, k), 1e-9);
+            }
+        }
+    }
+
+    // Headings wrap around and positions outside the lattice have no value
+    const State node{opt.origin + opt.resolution * Vector2D{4.0, 6.0}, 0.0};
+    EXPECT_NEAR(field.lookup({node.position, 2.0 * M_PI}), field.at(4, 6, 0), 1e-9);
+    EXPECT_TRUE(std::isinf(field.lookup({{-6.0, 0.0}, 0.0})));
+}
+
+TEST(CostFieldTest, trilinear_lookup)
+{
+    using namespace dubins;
+
+    const auto      opt = field_options();
+    const CostField field{{{0.0, 0.0}, 0.0}, opt};
+
+    // Halfway between nodes along every axis is the mean of the eight corners
+    const auto h  = 2.0 * M_PI / opt.headings;
+    const auto pt = opt.origin + opt.resolution * Vector2D{2.5, 7.5};
+
+    double mean = 0.0;
+    for (const auto x : {2, 3})
+    {
+        for (const auto y : {7, 8})
+        {
+            for (const auto k : {3, 4})
+            {
+                mean += field.at(x, y, k) / 8.0;
+            }
+        }
+    }
+    EXPECT_NEAR(field.lookup({pt, 3.5 * h}), mean, 1e-9);
+}
+
+TEST(CostFieldTest, save_and_load)
+{
+    using namespace dubins;
+
+    const auto      opt = field_options();
+    const CostField field{{{1.0, 2.0}, -1.0}, opt};
+
+    const auto filename = testing::TempDir() + "dubins_cost_field_test.bin";
+    ASSERT_TRUE(field.save(filename));
+
+    const auto loaded = CostField::load(filename);
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(loaded->options().width, opt.width);
+    EXPECT_EQ(loaded->options().headings, opt.headings);
+    EXPECT_EQ(loaded->goal().heading, -1.0);
+
+    for (std::int32_t k = 0; k < opt.headings; ++k)
+    {
+        EXPECT_EQ(loaded->at(7, 11, k), field.at(7, 11, k));
+    }
+    EXPECT_EQ(loaded->lookup({{0.1, 0.2}, 0.3}), field.lookup({{0.1, 0.2}, 0.3}));
+
+    // Truncated files are rejected
+    {
+        std::ofstream file{filename, std::ios::binary | std::ios::trunc};
+        file << "DBCF";
+    }
+    EXPECT_FALSE(CostField::load(filename).has_value());
+    std::remove(filename.c_str());
+}
@@ -0,0 +1,136 @@
+#include "dubins/DistanceMatrix.hpp"
+#include "dubins/PathDescriptor.hpp"
+#include "random_inputs.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <vector>
+
+
+TEST(DistanceMatrixTest, compute)
+{
+    using namespace dubins;
+
+    const auto states   = random_states(150, 3, 8.0);
+    const auto radius   = 1.1;
+    const auto filename = testing::TempDir() + "dubins_distance_matrix_test.bin";
+
+    for (const auto precision : {DistanceMatrix::Precision::float32, DistanceMatrix::Precision::float16})
+    {
+        DistanceMatrix::Options options;
+        options.tile      = 64;    // Does not divide the number of states, so edge tiles are padded
+        options.precision = precision;
+        options.threads   = 3;
+
+        const auto matrix = DistanceMatrix::compute(states, radius, filename, options);
+        ASSERT_TRUE(matrix.has_value());
+        EXPECT_EQ(matrix->size(), states.size());
+
+        const auto rel = precision == DistanceMatrix::Precision::float32 ? 1e-6 : 1e-3;
+        for (std::size_t i = 0; i < states.size(); i += 7)
+        {
+            for (std::size_t j = 0; j < states.size(); ++j)
+            {
+                const auto expected = i == j ? 0.0 : length(shortest_path(states[i], states[j], radius));
+                EXPECT_NEAR(matrix->at(i, j), expected, rel * expected);
+            }
+        }
+
+        const auto loaded = DistanceMatrix::load(filename);
+        ASSERT_TRUE(loaded.has_value());
+        EXPECT_EQ(loaded->size(), states.size());
+        EXPECT_EQ(loaded->options().tile, options.tile);
+        EXPECT_EQ(loaded->options().precision, precision);
+        EXPECT_DOUBLE_EQ(loaded->radius(), radius);
+        EXPECT_EQ(loaded->at(149, 3), matrix->at(149, 3));
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST(DistanceMatrixTest, resume)
+{
+    using namespace dubins;
+
+    const auto states   = random_states(100, 8, 8.0);
+    const auto radius   = 0.9;
+    const auto filename = testing::TempDir() + "dubins_distance_matrix_resume_test.bin";
+
+    DistanceMatrix::Options options;
+    options.tile = 50;
+    ASSERT_TRUE(DistanceMatrix::compute(states, radius, filename, options).has_value());
+
+    // Simulate a crash: tile 1 never finished, and tile 2 is garbage but flagged so it must not be recomputed. Tiles
+    // start at the first 4096 byte boundary after the 128 byte header and the completion flags.
+    const std::size_t tile_bytes = 50 * 50 * sizeof(float);
+    {
+        std::fstream file{filename, std::ios::binary | std::ios::in | std::ios::out};
+        const char   unfinished = 0;
+        file.seekp(128 + 1);
+        file.write(&unfinished, 1);
+
+        const std::vector<char> garbage(tile_bytes, 0);
+        file.seekp(4096 + 1 * tile_bytes);
+        file.write(garbage.data(), std::streamsize(garbage.size()));
+        file.seekp(4096 + 2 * tile_bytes);
+        file.write(garbage.data(), std::streamsize(garbage.size()));
+    }
+    EXPECT_FALSE(DistanceMatrix::load(filename).has_value());
+
+    const auto matrix = DistanceMatrix::compute(states, radius, filename, options);
+    ASSERT_TRUE(matrix.has_value());
+
+    // Tile 1 holds rows [0, 50) and columns [50, 100), tile 2 rows [50, 100) and columns [0, 50)
+    EXPECT_NEAR(matrix->at(3, 60), length(shortest_path(states[3], states[60], radius)), 1e-5);
+    EXPECT_EQ(matrix->at(60, 3), 0.0);
+
+    // Different states start over
+    auto moved = states;
+    moved[0].heading += 0.1;
+    const auto recomputed = DistanceMatrix::compute(moved, radius, filename, options);
+    ASSERT_TRUE(recomputed.has_value());
+    EXPECT_NEAR(recomputed->at(60, 3), length(shortest_path(moved[60], moved[3], radius)), 1e-5);
+
+    std::remove(filename.c_str());
+}
+
+TEST(DistanceMatrixTest, nearest_neighbours)
+{
+    using namespace dubins;
+
+    const auto states = random_states(200, 21, 8.0);
+    const auto radius = 1.4;
+
+    const auto neighbours = nearest_neighbours(states, radius, 5, 2);
+    ASSERT_EQ(neighbours.k, 5u);
+    ASSERT_EQ(neighbours.size(), states.size());
+
+    for (std::size_t i = 0; i < states.size(); ++i)
+    {
+        std::vector<double> lengths;
+        for (std::size_t j = 0; j < states.size(); ++j)
+        {
+            if (j != i)
+            {
+                lengths.push_back(length(shortest_path(states[i], states[j], radius)));
+            }
+        }
+        std::sort(lengths.begin(), lengths.end());
+
+        for (std::size_t n = 0; n < neighbours.k; ++n)
+        {
+            const auto j = neighbours.index[i * neighbours.k + n];
+            EXPECT_NE(j, i);
+            EXPECT_NEAR(neighbours.length[i * neighbours.k + n], lengths[n], 1e-9);
+            EXPECT_NEAR(neighbours.length[i * neighbours.k + n], length(shortest_path(states[i], states[j], radius)),
+                        1e-9);
+        }
+    }
+
+    // k is clamped to the number of other states
+    EXPECT_EQ(nearest_neighbours(random_states(3, 1, 8.0), radius, 10).k, 2u);
+    EXPECT_EQ(nearest_neighbours(random_states(1, 1, 8.0), radius, 10).size(), 0u);
+}
@@ -1,9 +1,13 @@
 #include "dubins/Dubins.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cmath>
 #include <gtest/gtest.h>
 #include <limits>
+#include <memory_resource>
+#include <new>
 #include <vector>
 
 #include "dubins/output.hpp"
@@ -123,4 +127,52 @@ TEST(DubinsTest, lsr)
 
     EXPECT_DOUBLE_EQ(path.length(), M_PI*opt.turning_radius);
     test_segments(segments, start, end);
-}
\ No newline at end of file
+}
+
+TEST(DubinsTest, memory_resource)
+{
+    using namespace dubins;
+
+    State start{{0.0, 0.0}, M_PI_2};
+    State end{{4.0, 4.0}, M_PI_2};
+
+    Dubins::Options opt;
+    opt.turning_radius         = 2.0;
+    opt.max_segment_length     = 0.1;
+    opt.min_number_of_segments = 20;
+
+    Dubins     reference{start, end, opt};
+    const auto expected = reference.segmented_path(opt);
+
+    // An arena without upstream fails loudly if anything falls back to the heap
+    std::array<std::byte, 1 << 16>      buffer;
+    std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+    for (int cycle = 0; cycle < 3; ++cycle)
+    {
+        {
+            Dubins     path{start, end, opt, &arena};
+            const auto segments = path.segmented_path(opt, &arena);
+
+            EXPECT_DOUBLE_EQ(path.length(), reference.length());
+            ASSERT_EQ(segments.size(), expected.size());
+            EXPECT_EQ(segments.get_allocator().resource(), &arena);
+            for (std::size_t i = 0; i < segments.size(); ++i)
+            {
+                EXPECT_DOUBLE_EQ(segments[i].position.x, expected[i].position.x);
+                EXPECT_DOUBLE_EQ(segments[i].position.y, expected[i].position.y);
+                EXPECT_DOUBLE_EQ(segments[i].heading, expected[i].heading);
+            }
+
+            EXPECT_EQ(path.segmented_lsl(opt, &arena).size(), reference.segmented_lsl(opt).size());
+            EXPECT_EQ(path.segmented_rlr(opt, &arena).size(), reference.segmented_rlr(opt).size());
+        }
+        arena.release();
+    }
+
+    // An exhausted arena throws instead of terminating
+    std::array<std::byte, 64>           small;
+    std::pmr::monotonic_buffer_resource exhausted{small.data(), small.size(), std::pmr::null_memory_resource()};
+    EXPECT_THROW((Dubins{start, end, opt, &exhausted}), std::bad_alloc);
+    EXPECT_THROW(reference.segmented_path(opt, &exhausted), std::bad_alloc);
+}
@@ -0,0 +1,97 @@
+#include "dubins/DynamicDistanceMatrix.hpp"
+#include "dubins/PathDescriptor.hpp"
+#include "random_inputs.hpp"
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+void expect_consistent(const dubins::DynamicDistanceMatrix& matrix)
+{
+    for (const auto from : matrix.ids())
+    {
+        for (const auto to : matrix.ids())
+        {
+            const auto expected =
+                from == to ? 0.0
+                           : length(dubins::shortest_path(matrix.state(from), matrix.state(to), matrix.radius()));
+            EXPECT_NEAR(matrix.at(from, to), expected, 1e-9);
+        }
+    }
+}
+
+}    // namespace
+
+TEST(DynamicDistanceMatrixTest, insert_erase_update)
+{
+    using namespace dubins;
+
+    std::mt19937 gen(17);
+
+    DynamicDistanceMatrix matrix{1.3, 3};
+
+    std::vector<DynamicDistanceMatrix::Id> ids;
+    for (int i = 0; i < 40; ++i)
+    {
+        ids.push_back(matrix.insert(random_state(gen)));
+    }
+    EXPECT_EQ(matrix.size(), 40u);
+    expect_consistent(matrix);
+
+    // Removed slots are reused, ids of the other states do not change
+    const auto kept = matrix.state(ids[7]);
+    matrix.erase(ids[3]);
+    matrix.erase(ids[20]);
+    EXPECT_FALSE(matrix.contains(ids[3]));
+    EXPECT_EQ(matrix.size(), 38u);
+
+    const auto reused = matrix.insert(random_state(gen));
+    EXPECT_EQ(reused, ids[20]);
+    EXPECT_EQ(matrix.slots(), 40u);
+    EXPECT_EQ(matrix.state(ids[7]).heading, kept.heading);
+
+    matrix.update(ids[11], random_state(gen));
+    matrix.update(ids[0], random_state(gen));
+    expect_consistent(matrix);
+
+    // Erasing twice or updating a removed slot does nothing
+    matrix.erase(ids[3]);
+    matrix.update(ids[3], random_state(gen));
+    EXPECT_EQ(matrix.size(), 39u);
+}
+
+TEST(DynamicDistanceMatrixTest, compact)
+{
+    using namespace dubins;
+
+    DynamicDistanceMatrix matrix{0.8};
+    for (int i = 0; i < 10; ++i)
+    {
+        matrix.insert({{double(i), 0.5 * double(i % 3)}, 0.3 * double(i)});
+    }
+    matrix.erase(2);
+    matrix.erase(5);
+    matrix.erase(9);
+
+    const auto before = matrix.at(6, 1);
+    const auto state  = matrix.state(6);
+    const auto remap  = matrix.compact();
+
+    ASSERT_EQ(remap.size(), 10u);
+    EXPECT_EQ(remap[2], DynamicDistanceMatrix::invalid_id);
+    EXPECT_EQ(remap[5], DynamicDistanceMatrix::invalid_id);
+    EXPECT_EQ(remap[9], DynamicDistanceMatrix::invalid_id);
+    EXPECT_EQ(remap[6], 4u);
+    EXPECT_EQ(matrix.slots(), 7u);
+    EXPECT_EQ(matrix.size(), 7u);
+    EXPECT_EQ(matrix.at(remap[6], remap[1]), before);
+    EXPECT_EQ(matrix.state(remap[6]).heading, state.heading);
+    expect_consistent(matrix);
+
+    // Growing again after compaction
+    matrix.insert({{-3.0, 2.0}, 1.0});
+    expect_consistent(matrix);
+}
@@ -0,0 +1,129 @@
+#include "dubins/Angle.hpp"
+#include "dubins/FreeHeading.hpp"
+#include "dubins/PathDescriptor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <utility>
+
+
+namespace
+{
+// Shortest path over densely sampled terminal headings in [lo, lo + width]
+double sampled_length(const dubins::State& start, const dubins::Vector2D& goal, double lo, double width,
+                      double radius)
+{
+    constexpr int samples = 2000;
+
+    auto best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i <= samples; ++i)
+    {
+        const auto heading = lo + width * double(i) / double(samples);
+        best               = std::min(best, length(dubins::shortest_path(start, {goal, heading}, radius)));
+    }
+    return best;
+}
+
+void expect_reaches(const dubins::FreeHeadingPath& result, const dubins::Vector2D& goal)
+{
+    const auto end = dubins::end_state(result.path);
+    EXPECT_NEAR(end.position.x, goal.x, 1e-6);
+    EXPECT_NEAR(end.position.y, goal.y, 1e-6);
+    EXPECT_NEAR(dubins::Angle::signed_difference(dubins::Angle{end.heading}, dubins::Angle{result.heading}), 0.0,
+                1e-6);
+}
+
+}    // namespace
+
+TEST(FreeHeadingTest, shortest_path_to_point)
+{
+    using namespace dubins;
+
+    const auto radius = 1.2;
+
+    std::mt19937                           gen(5);
+    std::uniform_real_distribution<double> pos(-5.0, 5.0);
+    std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+
+    for (int i = 0; i < 200; ++i)
+    {
+        const State    start{{pos(gen), pos(gen)}, heading(gen)};
+        const Vector2D goal{pos(gen), pos(gen)};
+
+        const auto result = shortest_path_to_point(start, goal, radius);
+        expect_reaches(result, goal);
+
+        // The optimum can not be longer than the path to any sampled heading
+        EXPECT_LE(length(result.path), sampled_length(start, goal, -M_PI, 2.0 * M_PI, radius) + 1e-9);
+    }
+
+    // Straight ahead
+    const auto ahead = shortest_path_to_point({{0.0, 0.0}, 0.0}, {3.0, 0.0}, 1.0);
+    EXPECT_NEAR(length(ahead.path), 3.0, 1e-9);
+    EXPECT_NEAR(ahead.heading, 0.0, 1e-9);
+
+    // Close beside the start, inside the right turning circle, a straight line can not be reached with a right turn
+    const Vector2D beside{0.0, -0.5};
+    const auto     close = shortest_path_to_point({{0.0, 0.0}, 0.0}, beside, 1.0);
+    expect_reaches(close, beside);
+    EXPECT_EQ(close.path.word, Word::LRL);
+    EXPECT_LE(length(close.path), sampled_length({{0.0, 0.0}, 0.0}, beside, -M_PI, 2.0 * M_PI, 1.0) + 1e-9);
+}
+
+TEST(FreeHeadingTest, shortest_path_to_interval)
+{
+    using namespace dubins;
+
+    const auto radius = 0.8;
+
+    std::mt19937                           gen(9);
+    std::uniform_real_distribution<double> pos(-4.0, 4.0);
+    std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+    std::uniform_real_distribution<double> width(0.0, 2.0 * M_PI);
+
+    for (int i = 0; i < 200; ++i)
+    {
+        const State    start{{pos(gen), pos(gen)}, heading(gen)};
+        const Vector2D goal{pos(gen), pos(gen)};
+        const auto     lo = heading(gen);
+        const auto     w  = width(gen);
+
+        const auto result = shortest_path_to_interval(start, goal, lo, lo + w, radius);
+        expect_reaches(result, goal);
+        EXPECT_LE(Angle::positive_difference(Angle{result.heading}, Angle{lo}), w + 1e-9);
+
+        EXPECT_LE(length(result.path), sampled_length(start, goal, lo, w, radius) + 1e-9);
+    }
+
+    // An interval containing the free heading optimum gives the free heading solution
+    const State    start{{0.0, 0.0}, 0.3};
+    const Vector2D goal{2.0, 3.0};
+    const auto     free = shortest_path_to_point(start, goal, radius);
+    const auto     wide = shortest_path_to_interval(start, goal, free.heading - 0.5, free.heading + 0.5, radius);
+    EXPECT_NEAR(length(wide.path), length(free.path), 1e-9);
+    EXPECT_NEAR(wide.heading, free.heading, 1e-9);
+
+    // A single heading gives the ordinary shortest path
+    const auto fixed = shortest_path_to_interval(start, goal, 1.0, 1.0, radius);
+    EXPECT_NEAR(length(fixed.path), length(shortest_path(start, {goal, 1.0}, radius)), 1e-9);
+
+    // A full turn allows any heading however it is written, it must not wrap to an empty interval
+    const State    origin{{0.0, 0.0}, 0.0};
+    const Vector2D above{0.0, 3.0};
+    const auto     any = shortest_path_to_point(origin, above, 1.0);
+    EXPECT_NEAR(length(any.path), 3.8264, 1e-4);
+    for (const auto& [lo, hi] : {std::pair{-M_PI, M_PI}, std::pair{0.0, 2.0 * M_PI}, std::pair{-4.0, 4.0}})
+    {
+        const auto full = shortest_path_to_interval(origin, above, lo, hi, 1.0);
+        EXPECT_NEAR(length(full.path), length(any.path), 1e-9) << lo << " " << hi;
+        EXPECT_NEAR(full.heading, any.heading, 1e-9) << lo << " " << hi;
+    }
+
+    // An end before the start wraps through pi
+    const auto wrapped = shortest_path_to_interval(origin, above, 3.0, -3.0, 1.0);
+    expect_reaches(wrapped, above);
+    EXPECT_LE(Angle::positive_difference(Angle{wrapped.heading}, Angle{3.0}), 2.0 * M_PI - 6.0 + 1e-9);
+}
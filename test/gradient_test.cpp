@@ -0,0 +1,205 @@
+#include "dubins/Angle.hpp"
+#include "dubins/Gradient.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+// Parameters of a path in the order of a gradient
+using Parameters = std::array<double, 7>;
+
+Parameters parameters(const dubins::State& start, const dubins::State& end, double radius)
+{
+    return {start.position.x, start.position.y, start.heading, end.position.x, end.position.y, end.heading, radius};
+}
+
+dubins::PathDescriptor path_of(const Parameters& p, dubins::Word word)
+{
+    return dubins::word_path({{p[0], p[1]}, p[2]}, {{p[3], p[4]}, p[5]}, p[6], word);
+}
+
+// Central difference of f along every parameter
+template<typename F>
+dubins::Gradient central_difference(const Parameters& p, F&& f)
+{
+    constexpr double h = 1e-6;
+
+    dubins::Gradient g{};
+    for (std::size_t i = 0; i < g.size(); ++i)
+    {
+        auto plus  = p;
+        auto minus = p;
+        plus[i] += h;
+        minus[i] -= h;
+        g[i] = (f(plus) - f(minus)) / (2.0 * h);
+    }
+    return g;
+}
+
+void expect_near(const dubins::Gradient& a, const dubins::Gradient& b, double tolerance)
+{
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        EXPECT_NEAR(a[i], b[i], tolerance) << "parameter " << i;
+    }
+}
+
+}    // namespace
+
+TEST(GradientTest, length_matches_finite_difference)
+{
+    using namespace dubins;
+
+    std::mt19937                           gen(11);
+    std::uniform_real_distribution<double> pos(-6.0, 6.0);
+    std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+    std::uniform_real_distribution<double> radius(0.5, 2.0);
+
+    std::size_t checked = 0;
+    for (std::size_t i = 0; i < 2000; ++i)
+    {
+        const State start{{pos(gen), pos(gen)}, heading(gen)};
+        const State end{{pos(gen), pos(gen)}, heading(gen)};
+        const auto  r = radius(gen);
+
+        const auto gradient = path_gradient(start, end, r, 1e-3);
+        EXPECT_NEAR(length(gradient.path), length(shortest_path(start, end, r)), 1e-12);
+        if (gradient.near_switch)
+        {
+            continue;
+        }
+
+        // Every segment, holding the word fixed
+        const auto p    = parameters(start, end, r);
+        const auto word = gradient.path.word;
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            expect_near(gradient.segments[k], central_difference(p, [&](const Parameters& q) {
+                            return path_of(q, word).segments[k];
+                        }),
+                        1e-5);
+        }
+        expect_near(gradient.length, central_difference(p, [&](const Parameters& q) {
+                        return length(shortest_path({{q[0], q[1]}, q[2]}, {{q[3], q[4]}, q[5]}, q[6]));
+                    }),
+                    1e-5);
+        ++checked;
+    }
+
+    // Most pairs are away from a switch
+    EXPECT_GT(checked, 1000u);
+}
+
+TEST(GradientTest, every_word)
+{
+    using namespace dubins;
+
+    std::mt19937                           gen(5);
+    std::uniform_real_distribution<double> pos(-3.0, 3.0);
+    std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+
+    std::array<std::size_t, 6> checked{};
+    for (std::size_t i = 0; i < 4000; ++i)
+    {
+        const State start{{pos(gen), pos(gen)}, heading(gen)};
+        const State end{{pos(gen), pos(gen)}, heading(gen)};
+        const auto  word = static_cast<Word>(i % 6);
+
+        const auto path = word_path(start, end, 1.0, word);
+        if (!std::isfinite(length(path)))
+        {
+            continue;
+        }
+
+        const auto gradient = path_gradient(path, 1e-3);
+        if (gradient.near_switch)
+        {
+            continue;
+        }
+
+        const auto p = parameters(start, end, 1.0);
+        expect_near(gradient.length,
+                    central_difference(p, [&](const Parameters& q) { return length(path_of(q, word)); }), 1e-5);
+        ++checked[i % 6];
+    }
+
+    for (const auto count : checked)
+    {
+        EXPECT_GT(count, 100u);
+    }
+}
+
+TEST(GradientTest, poses)
+{
+    using namespace dubins;
+
+    std::mt19937                           gen(7);
+    std::uniform_real_distribution<double> pos(-5.0, 5.0);
+    std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+
+    std::vector<PoseGradient> poses;
+    for (std::size_t i = 0; i < 300; ++i)
+    {
+        const State start{{pos(gen), pos(gen)}, heading(gen)};
+        const State end{{pos(gen), pos(gen)}, heading(gen)};
+
+        const auto gradient = path_gradient(start, end, 1.5, 1e-3);
+        if (gradient.near_switch)
+        {
+            continue;
+        }
+
+        const auto total = length(gradient.path);
+        const auto word  = gradient.path.word;
+        const auto p     = parameters(start, end, 1.5);
+
+        std::vector<double> distances{0.0, 0.3 * total, 0.5 * total, 0.9 * total, total};
+        pose_gradients(gradient, distances, poses);
+        ASSERT_EQ(poses.size(), distances.size());
+
+        for (std::size_t j = 0; j < distances.size(); ++j)
+        {
+            const auto expected = state_at(gradient.path, distances[j]);
+            EXPECT_NEAR(poses[j].state.position.x, expected.position.x, 1e-12);
+            EXPECT_NEAR(poses[j].state.position.y, expected.position.y, 1e-12);
+
+            // Skip distances that sit on a segment boundary, where the pose has a kink
+            const auto& s = gradient.path.segments;
+            if (std::abs(distances[j] - s[0]) < 1e-3 || std::abs(distances[j] - s[0] - s[1]) < 1e-3)
+            {
+                continue;
+            }
+
+            // The last distance follows the length
+            const auto at = [&](const Parameters& q, std::size_t component) {
+                const auto path  = path_of(q, word);
+                const auto state = state_at(path, j + 1 == distances.size() ? length(path) : distances[j]);
+                return component == 0 ? state.position.x : component == 1 ? state.position.y : state.heading;
+            };
+            expect_near(poses[j].x, central_difference(p, [&](const Parameters& q) { return at(q, 0); }), 1e-5);
+            expect_near(poses[j].y, central_difference(p, [&](const Parameters& q) { return at(q, 1); }), 1e-5);
+            expect_near(poses[j].heading, central_difference(p, [&](const Parameters& q) { return at(q, 2); }),
+                        1e-5);
+        }
+
+        // The end of the path only moves with the end state
+        const auto& last = poses.back();
+        expect_near(last.x, {0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0}, 1e-9);
+        expect_near(last.y, {0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0}, 1e-9);
+        expect_near(last.heading, {0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0}, 1e-9);
+    }
+}
+
+TEST(GradientTest, near_switch)
+{
+    using namespace dubins;
+
+    // Straight ahead LSL and RSR tie with arcs of zero length
+    const State start{{0.0, 0.0}, 0.0};
+    EXPECT_TRUE(path_gradient(start, {{10.0, 0.0}, 0.0}, 1.0).near_switch);
+    EXPECT_FALSE(path_gradient(start, {{10.0, 3.0}, 1.0}, 1.0).near_switch);
+}
@@ -0,0 +1,106 @@
+#include "dubins/HeadingOptimizer.hpp"
+#include "dubins/PathDescriptor.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+
+TEST(HeadingOptimizerTest, collinear_points)
+{
+    using namespace dubins;
+
+    std::vector<Vector2D> points{{0.0, 0.0}, {3.0, 3.0}, {6.0, 6.0}, {10.0, 10.0}};
+
+    HeadingOptimizer::Options opt;
+    opt.turning_radius = 1.0;
+    opt.heading_levels = 16;
+    opt.threads        = 2;
+
+    HeadingOptimizer optimizer{points, opt};
+
+    EXPECT_NEAR(optimizer.length(), norm(points.back() - points.front()), 1e-9);
+    for (const auto heading : optimizer.headings())
+    {
+        EXPECT_NEAR(heading, M_PI_4, 1e-4);
+    }
+}
+
+TEST(HeadingOptimizerTest, levels_converge)
+{
+    using namespace dubins;
+
+    std::vector<Vector2D> points{{0.0, 0.0}, {4.0, 1.0}, {5.0, 5.0}, {1.0, 6.0}, {-2.0, 2.0}, {2.0, -3.0}};
+
+    HeadingOptimizer::Options opt;
+    opt.turning_radius     = 1.5;
+    opt.min_heading_levels = 4;
+    opt.heading_levels     = 64;
+
+    HeadingOptimizer optimizer{points, opt};
+
+    const auto& levels = optimizer.levels();
+    ASSERT_EQ(levels.size(), 5U);
+    EXPECT_EQ(levels.front().heading_levels, 4);
+    EXPECT_EQ(levels.back().heading_levels, 64);
+
+    // Candidate sets are nested when doubling, so more levels can never be worse
+    for (std::size_t i = 1; i < levels.size(); ++i)
+    {
+        EXPECT_LE(levels[i].length, levels[i - 1].length + 1e-12);
+    }
+
+    // Refinement never makes the route longer, and the reported length matches the headings
+    EXPECT_LE(optimizer.length(), levels.back().length + 1e-12);
+
+    const auto states = optimizer.states();
+    double     len    = 0.0;
+    for (std::size_t i = 0; i + 1 < states.size(); ++i)
+    {
+        len += length(shortest_path(states[i], states[i + 1], opt.turning_radius));
+    }
+    EXPECT_NEAR(len, optimizer.length(), 1e-9);
+}
+
+TEST(HeadingOptimizerTest, not_worse_than_chord_headings)
+{
+    using namespace dubins;
+
+    std::vector<Vector2D> points{{0.0, 0.0}, {2.0, 0.5}, {2.5, 2.5}, {0.0, 3.0}, {-1.0, 0.0}};
+
+    HeadingOptimizer::Options opt;
+    opt.turning_radius = 1.0;
+
+    HeadingOptimizer optimizer{points, opt};
+
+    // Headings pointing at the next point are a common hand-made choice
+    std::vector<State> states;
+    for (std::size_t i = 0; i < points.size(); ++i)
+    {
+        const auto next = i + 1 < points.size() ? points[i + 1] - points[i] : points[i] - points[i - 1];
+        states.push_back({points[i], std::atan2(next.y, next.x)});
+    }
+
+    double chord_length = 0.0;
+    for (std::size_t i = 0; i + 1 < states.size(); ++i)
+    {
+        chord_length += length(shortest_path(states[i], states[i + 1], opt.turning_radius));
+    }
+
+    EXPECT_LT(optimizer.length(), chord_length);
+}
+
+TEST(HeadingOptimizerTest, degenerate_input)
+{
+    using namespace dubins;
+
+    HeadingOptimizer::Options opt;
+
+    HeadingOptimizer empty{{}, opt};
+    EXPECT_TRUE(empty.headings().empty());
+    EXPECT_DOUBLE_EQ(empty.length(), 0.0);
+
+    HeadingOptimizer single{{{1.0, 2.0}}, opt};
+    EXPECT_EQ(single.headings().size(), 1U);
+    EXPECT_DOUBLE_EQ(single.length(), 0.0);
+}
@@ -0,0 +1,122 @@
+#include "dubins/Angle.hpp"
+#include "dubins/HybridAStar.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+
+namespace
+{
+// 30 x 20 m grid of 0.5 m cells with a wall at x = 15 m. The wall has a gap at y in [15, 19) m unless closed.
+std::vector<std::uint8_t> wall(const dubins::Grid& grid, bool closed)
+{
+    std::vector<std::uint8_t> occupancy(std::size_t(grid.width * grid.height), 0);
+    for (std::int32_t y = 0; y < grid.height; ++y)
+    {
+        if (!closed && y >= 30 && y < 38)
+        {
+            continue;
+        }
+        occupancy[std::size_t(y * grid.width + 30)] = 1;
+        occupancy[std::size_t(y * grid.width + 31)] = 1;
+    }
+    return occupancy;
+}
+
+void expect_connected(const dubins::HybridAStarPlan& plan, const dubins::State& start, const dubins::State& goal)
+{
+    using namespace dubins;
+
+    ASSERT_FALSE(plan.segments.empty());
+    auto   current = start;
+    double total   = 0.0;
+    for (const auto& segment : plan.segments)
+    {
+        EXPECT_NEAR(segment.start.position.x, current.position.x, 1e-9);
+        EXPECT_NEAR(segment.start.position.y, current.position.y, 1e-9);
+        EXPECT_NEAR(Angle::signed_difference(Angle{segment.start.heading}, Angle{current.heading}), 0.0, 1e-9);
+        current = end_state(segment);
+        total += length(segment);
+    }
+
+    EXPECT_NEAR(current.position.x, goal.position.x, 1e-6);
+    EXPECT_NEAR(current.position.y, goal.position.y, 1e-6);
+    EXPECT_NEAR(Angle::signed_difference(Angle{current.heading}, Angle{goal.heading}), 0.0, 1e-6);
+    EXPECT_NEAR(plan.length, total, 1e-9);
+}
+
+}    // namespace
+
+TEST(HybridAStarTest, open_space)
+{
+    using namespace dubins;
+
+    const Grid grid{{0.0, 0.0}, 0.5, 60, 40};
+
+    HybridAStar::Options options;
+    options.turning_radius = 2.0;
+
+    HybridAStar planner{grid, std::vector<std::uint8_t>(60 * 40, 0), options};
+
+    const State start{{5.0, 5.0}, 0.0};
+    const State goal{{20.0, 14.0}, M_PI_2};
+
+    // The first shot is free
+    const auto plan = planner.plan(start, goal);
+    ASSERT_TRUE(plan.has_value());
+    EXPECT_EQ(plan->segments.size(), 1u);
+    EXPECT_NEAR(plan->length, length(shortest_path(start, goal, 2.0)), 1e-9);
+    EXPECT_EQ(planner.statistics().shots, 1u);
+    EXPECT_EQ(planner.statistics().accepted_broad, 1u);
+    expect_connected(*plan, start, goal);
+}
+
+TEST(HybridAStarTest, through_gap)
+{
+    using namespace dubins;
+
+    const Grid grid{{0.0, 0.0}, 0.5, 60, 40};
+
+    HybridAStar::Options options;
+    options.turning_radius = 1.5;
+    options.headings       = 36;
+    options.shot_interval  = 3;
+
+    HybridAStar planner{grid, wall(grid, false), options};
+
+    const State start{{5.0, 3.0}, 0.0};
+    const State goal{{25.0, 3.0}, 0.0};
+
+    const auto plan = planner.plan(start, goal);
+    ASSERT_TRUE(plan.has_value());
+    expect_connected(*plan, start, goal);
+
+    for (const auto& segment : plan->segments)
+    {
+        EXPECT_TRUE(planner.free(segment));
+    }
+
+    // The direct shot crosses the wall and never needs a traversal to find out
+    const auto& stats = planner.statistics();
+    EXPECT_GT(stats.expansions, 1u);
+    EXPECT_GT(stats.rejected_early, 0u);
+    EXPECT_GT(stats.cached, 0u);
+    EXPECT_LE(stats.rejected_early + stats.accepted_broad + stats.traversals, stats.shots);
+    EXPECT_FALSE(planner.free(shortest_path(start, goal, 1.5)));
+}
+
+TEST(HybridAStarTest, unreachable)
+{
+    using namespace dubins;
+
+    const Grid grid{{0.0, 0.0}, 0.5, 60, 40};
+
+    HybridAStar planner{grid, wall(grid, true), {}};
+
+    EXPECT_FALSE(planner.plan({{5.0, 10.0}, 0.0}, {{25.0, 10.0}, 0.0}).has_value());
+    EXPECT_EQ(planner.statistics().traversals, 0u);
+
+    // Outside the grid
+    EXPECT_FALSE(planner.plan({{-5.0, 10.0}, 0.0}, {{5.0, 10.0}, 0.0}).has_value());
+}
@@ -0,0 +1,211 @@
+#include "dubins/Circle.hpp"
+#include "dubins/Isa.hpp"
+#include "dubins/OneToMany.hpp"
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Trig.hpp"
+#include "random_inputs.hpp"
+
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+constexpr dubins::Isa all_isas[] = {dubins::Isa::scalar, dubins::Isa::generic, dubins::Isa::avx2, dubins::Isa::avx512};
+
+// Restores the instruction set and trig mode in use when it was created
+class IsaGuard
+{
+    public:
+    ~IsaGuard()
+    {
+        dubins::set_isa(m_isa);
+        dubins::set_trig_mode(m_trig);
+    }
+
+    private:
+    dubins::Isa      m_isa{dubins::isa()};
+    dubins::TrigMode m_trig{dubins::trig_mode()};
+};
+
+}    // namespace
+
+TEST(IsaTest, names)
+{
+    using namespace dubins;
+
+    for (const auto isa : all_isas)
+    {
+        EXPECT_EQ(isa_from_string(to_string(isa)), isa);
+    }
+    EXPECT_FALSE(isa_from_string("sse9").has_value());
+    EXPECT_FALSE(isa_from_string("").has_value());
+}
+
+TEST(IsaTest, set_isa)
+{
+    using namespace dubins;
+    IsaGuard guard;
+
+    EXPECT_TRUE(isa_supported(Isa::scalar));
+    EXPECT_TRUE(isa_supported(Isa::generic));
+    EXPECT_TRUE(isa_supported(isa()));
+
+    for (const auto isa : all_isas)
+    {
+        const auto before = dubins::isa();
+        EXPECT_EQ(set_isa(isa), isa_supported(isa));
+        EXPECT_EQ(dubins::isa(), isa_supported(isa) ? isa : before);
+    }
+}
+
+TEST(IsaTest, default_isa_from_environment)
+{
+    using namespace dubins;
+
+    const auto* value    = std::getenv("DUBINS_ISA");
+    const auto  previous = value ? std::optional<std::string>{value} : std::nullopt;
+
+    unsetenv("DUBINS_ISA");
+    const auto best = default_isa();
+    EXPECT_TRUE(isa_supported(best));
+    EXPECT_NE(best, Isa::scalar);
+
+    // A supported name wins, anything else falls back to the best supported instruction set
+    for (const auto isa : all_isas)
+    {
+        setenv("DUBINS_ISA", std::string{to_string(isa)}.c_str(), 1);
+        EXPECT_EQ(default_isa(), isa_supported(isa) ? isa : best) << to_string(isa);
+    }
+    setenv("DUBINS_ISA", "sse9", 1);
+    EXPECT_EQ(default_isa(), best);
+
+    if (previous)
+    {
+        setenv("DUBINS_ISA", previous->c_str(), 1);
+    }
+    else
+    {
+        unsetenv("DUBINS_ISA");
+    }
+}
+
+TEST(IsaTest, one_to_many_matches_scalar)
+{
+    using namespace dubins;
+    IsaGuard guard;
+
+    const State start{{0.4, -0.9}, 1.3};
+    const auto  goals = random_states(1001, 17, 6.0);
+
+    for (const auto mode : {TrigMode::exact, TrigMode::approximate})
+    {
+        set_trig_mode(mode);
+
+        std::vector<double>         expected_lengths;
+        std::vector<PathDescriptor> expected_paths;
+        ASSERT_TRUE(set_isa(Isa::scalar));
+        one_to_many(start, goals, 1.2, expected_lengths);
+        one_to_many(start, goals, 1.2, expected_paths);
+
+        for (const auto isa : all_isas)
+        {
+            if (!set_isa(isa))
+            {
+                continue;
+            }
+
+            std::vector<double>         lengths;
+            std::vector<PathDescriptor> paths;
+            one_to_many(start, goals, 1.2, lengths);
+            one_to_many(start, goals, 1.2, paths);
+            ASSERT_EQ(lengths.size(), goals.size());
+            ASSERT_EQ(paths.size(), goals.size());
+
+            // Fused multiply-add changes the last bits, and with them the word where two are equally short
+            for (std::size_t i = 0; i < goals.size(); ++i)
+            {
+                EXPECT_NEAR(lengths[i], expected_lengths[i], 1e-9) << to_string(isa) << " " << i;
+                EXPECT_NEAR(length(paths[i]), length(expected_paths[i]), 1e-9) << to_string(isa) << " " << i;
+            }
+        }
+    }
+}
+
+TEST(IsaTest, batch_kernels_match_scalar)
+{
+    using namespace dubins;
+    IsaGuard guard;
+
+    std::mt19937 gen(23);
+    const auto   a = random_circles(gen, 1001);
+    const auto   b = random_circles(gen, 1001);
+
+    for (const auto ra : {Rotation::cw, Rotation::ccw})
+    {
+        for (const auto rb : {Rotation::cw, Rotation::ccw})
+        {
+            Lines                     expected;
+            std::vector<std::uint8_t> expected_valid;
+            ASSERT_TRUE(set_isa(Isa::scalar));
+            calculate_transfer_lines(a, ra, b, rb, expected, expected_valid);
+
+            for (const auto isa : all_isas)
+            {
+                Lines                     lines;
+                std::vector<std::uint8_t> valid;
+                if (!set_isa(isa))
+                {
+                    continue;
+                }
+                calculate_transfer_lines(a, ra, b, rb, lines, valid);
+                ASSERT_EQ(valid, expected_valid) << to_string(isa);
+
+                for (std::size_t i = 0; i < lines.size(); ++i)
+                {
+                    if (valid[i])
+                    {
+                        EXPECT_NEAR(lines.ax[i], expected.ax[i], 1e-12) << to_string(isa) << " " << i;
+                        EXPECT_NEAR(lines.ay[i], expected.ay[i], 1e-12) << to_string(isa) << " " << i;
+                        EXPECT_NEAR(lines.bx[i], expected.bx[i], 1e-12) << to_string(isa) << " " << i;
+                        EXPECT_NEAR(lines.by[i], expected.by[i], 1e-12) << to_string(isa) << " " << i;
+                    }
+                }
+            }
+        }
+    }
+
+    for (const auto rotation : {Rotation::cw, Rotation::ccw})
+    {
+        Circles                   expected;
+        std::vector<std::uint8_t> expected_valid;
+        ASSERT_TRUE(set_isa(Isa::scalar));
+        calculate_transfer_circles(a, b, rotation, 1.5, expected, expected_valid);
+
+        for (const auto isa : all_isas)
+        {
+            Circles                   circles;
+            std::vector<std::uint8_t> valid;
+            if (!set_isa(isa))
+            {
+                continue;
+            }
+            calculate_transfer_circles(a, b, rotation, 1.5, circles, valid);
+            ASSERT_EQ(valid, expected_valid) << to_string(isa);
+
+            for (std::size_t i = 0; i < circles.size(); ++i)
+            {
+                if (valid[i])
+                {
+                    EXPECT_NEAR(circles.x[i], expected.x[i], 1e-12) << to_string(isa) << " " << i;
+                    EXPECT_NEAR(circles.y[i], expected.y[i], 1e-12) << to_string(isa) << " " << i;
+                    EXPECT_EQ(circles.radius[i], 1.5);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,91 @@
+#include "dubins/MotionPrimitives.hpp"
+#include "dubins/PathDescriptor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <set>
+#include <utility>
+
+
+TEST(MotionPrimitivesTest, matches_direct_solution)
+{
+    using namespace dubins;
+
+    MotionPrimitiveTable::Options opt;
+    opt.resolution     = 0.5;
+    opt.range          = 2;
+    opt.headings       = 8;
+    opt.turning_radius = 0.8;
+    opt.swept_cells    = true;
+    opt.threads        = 2;
+
+    const MotionPrimitiveTable table{opt};
+
+    // Every (start heading, offset, end heading) except staying in place
+    const auto total = std::size_t(opt.headings * 25 * opt.headings - opt.headings);
+    ASSERT_EQ(table.primitives().size(), total);
+    EXPECT_LT(table.solved_count() * 6, total);
+
+    const auto step = 2.0 * M_PI / opt.headings;
+    for (const auto& primitive : table.primitives())
+    {
+        const State start{{0.0, 0.0}, step * primitive.start_heading};
+        const State end{opt.resolution * Vector2D{double(primitive.dx), double(primitive.dy)},
+                        step * primitive.end_heading};
+
+        const auto expected = shortest_path(start, end, opt.turning_radius);
+        EXPECT_NEAR(primitive.length, length(expected), 1e-9);
+
+        // The mapped word and segments form a valid path to the end pose
+        const auto path = table.path(primitive);
+        const auto last = end_state(path);
+        EXPECT_NEAR(last.position.x, end.position.x, 1e-9);
+        EXPECT_NEAR(last.position.y, end.position.y, 1e-9);
+        EXPECT_NEAR(std::remainder(last.heading - end.heading, 2.0 * M_PI), 0.0, 1e-9);
+
+        const auto box = bounds(path);
+        EXPECT_NEAR(primitive.bounds.min.x, box.min.x, 1e-9);
+        EXPECT_NEAR(primitive.bounds.min.y, box.min.y, 1e-9);
+        EXPECT_NEAR(primitive.bounds.max.x, box.max.x, 1e-9);
+        EXPECT_NEAR(primitive.bounds.max.y, box.max.y, 1e-9);
+
+        // Swept cells start in the origin cell and end in the cell of the end pose
+        const auto [first, last_cell] = table.cells(primitive);
+        ASSERT_GT(last_cell - first, 0);
+        std::set<std::pair<int, int>> swept;
+        for (auto it = first; it != last_cell; ++it)
+        {
+            swept.insert({it->x, it->y});
+        }
+        EXPECT_EQ(swept.count({0, 0}), 1U);
+        EXPECT_EQ(swept.count({primitive.dx, primitive.dy}), 1U);
+    }
+}
+
+TEST(MotionPrimitivesTest, grouped_by_heading)
+{
+    using namespace dubins;
+
+    MotionPrimitiveTable::Options opt;
+    opt.range      = 3;
+    opt.headings   = 16;
+    opt.max_length = 4.0;
+
+    const MotionPrimitiveTable table{opt};
+    ASSERT_FALSE(table.primitives().empty());
+
+    std::size_t count = 0;
+    for (std::int32_t k = 0; k < opt.headings; ++k)
+    {
+        const auto [first, last] = table.from_heading(k);
+        for (auto it = first; it != last; ++it)
+        {
+            EXPECT_EQ(it->start_heading, k);
+            EXPECT_LE(it->length, opt.max_length);
+            EXPECT_EQ(it->cells_count, 0U);
+        }
+        count += std::size_t(last - first);
+    }
+    EXPECT_EQ(count, table.primitives().size());
+}
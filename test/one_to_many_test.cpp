@@ -0,0 +1,85 @@
+#include "dubins/OneToMany.hpp"
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Trig.hpp"
+#include "random_inputs.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+
+TEST(OneToManyTest, matches_shortest_path)
+{
+    using namespace dubins;
+
+    const State start{{0.7, -1.2}, 2.1};
+    const auto  goals  = random_states(2000, 11);
+    const auto  radius = 1.3;
+
+    std::vector<double>         lengths;
+    std::vector<PathDescriptor> paths;
+    one_to_many(start, goals, radius, lengths);
+    one_to_many(start, goals, radius, paths);
+    ASSERT_EQ(lengths.size(), goals.size());
+    ASSERT_EQ(paths.size(), goals.size());
+
+    for (std::size_t i = 0; i < goals.size(); ++i)
+    {
+        const auto expected = length(shortest_path(start, goals[i], radius));
+        EXPECT_NEAR(lengths[i], expected, 1e-9);
+        EXPECT_NEAR(length(paths[i]), expected, 1e-9);
+
+        // The returned path actually reaches the goal
+        const auto end = end_state(paths[i]);
+        EXPECT_NEAR(end.position.x, goals[i].position.x, 1e-8);
+        EXPECT_NEAR(end.position.y, goals[i].position.y, 1e-8);
+        EXPECT_NEAR(std::remainder(end.heading - goals[i].heading, 2.0 * M_PI), 0.0, 1e-8);
+    }
+}
+
+TEST(OneToManyTest, many_to_one)
+{
+    using namespace dubins;
+
+    const State goal{{-0.4, 2.0}, -0.3};
+    const auto  starts = random_states(500, 5);
+    const auto  radius = 0.9;
+
+    std::vector<double>         lengths;
+    std::vector<PathDescriptor> paths;
+    many_to_one(starts, goal, radius, lengths);
+    many_to_one(starts, goal, radius, paths);
+
+    for (std::size_t i = 0; i < starts.size(); ++i)
+    {
+        const auto expected = length(shortest_path(starts[i], goal, radius));
+        EXPECT_NEAR(lengths[i], expected, 1e-9);
+
+        const auto end = end_state(paths[i]);
+        EXPECT_NEAR(end.position.x, goal.position.x, 1e-8);
+        EXPECT_NEAR(end.position.y, goal.position.y, 1e-8);
+        EXPECT_NEAR(std::remainder(end.heading - goal.heading, 2.0 * M_PI), 0.0, 1e-8);
+    }
+}
+
+TEST(OneToManyTest, approximate_trig)
+{
+    using namespace dubins;
+
+    const auto previous = trig_mode();
+    set_trig_mode(TrigMode::approximate);
+
+    const State start{{0.0, 0.0}, 0.0};
+    const auto  goals = random_states(500, 9);
+
+    std::vector<double> lengths;
+    one_to_many(start, goals, 1.0, lengths);
+
+    set_trig_mode(TrigMode::exact);
+    for (std::size_t i = 0; i < goals.size(); ++i)
+    {
+        EXPECT_NEAR(lengths[i], length(shortest_path(start, goals[i], 1.0)), 1e-8);
+    }
+
+    set_trig_mode(previous);
+}
@@ -0,0 +1,238 @@
+#include "dubins/Dubins.hpp"
+#include "dubins/PathDescriptor.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <limits>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+
+
+TEST(PathDescriptorTest, matches_dubins_length)
+{
+    using namespace dubins;
+
+    Dubins::Options opt;
+    opt.turning_radius = 1.5;
+
+    for (double x = -6.0; x <= 6.0; x += 1.7)
+    {
+        for (double heading = -3.0; heading < 3.2; heading += 0.6)
+        {
+            State start{{0.0, 0.0}, 0.3};
+            State end{{x, 0.5 * x + 1.0}, heading};
+
+            Dubins     path{start, end, opt};
+            const auto desc = shortest_path(start, end, opt.turning_radius);
+
+            EXPECT_NEAR(length(desc), path.length(), 1e-12);
+        }
+    }
+}
+
+TEST(PathDescriptorTest, end_state_reaches_goal)
+{
+    using namespace dubins;
+
+    for (double x = -6.0; x <= 6.0; x += 1.3)
+    {
+        for (double heading = -3.0; heading < 3.2; heading += 0.4)
+        {
+            State start{{1.0, -2.0}, -0.7};
+            State end{{x, 2.0 - x}, heading};
+
+            const auto desc  = shortest_path(start, end, 2.0);
+            const auto state = end_state(desc);
+
+            EXPECT_NEAR(state.position.x, end.position.x, 1e-9);
+            EXPECT_NEAR(state.position.y, end.position.y, 1e-9);
+            EXPECT_NEAR(std::remainder(state.heading - end.heading, 2.0 * M_PI), 0.0, 1e-9);
+        }
+    }
+}
+
+TEST(PathDescriptorTest, coincident_states)
+{
+    using namespace dubins;
+
+    State start{{1.0, 1.0}, 0.5};
+
+    const auto desc = shortest_path(start, start, 1.0);
+
+    EXPECT_NEAR(length(desc), 0.0, 1e-12);
+}
+
+TEST(PathDescriptorTest, sample_spacing)
+{
+    using namespace dubins;
+
+    State start{{0.0, 0.0}, M_PI_2};
+    State end{{5.0, 0.0}, -M_PI_2};
+
+    const auto desc = shortest_path(start, end, 2.0);
+    ASSERT_EQ(desc.word, Word::RSR);
+
+    std::vector<State> states;
+    sample(desc, 0.0, length(desc) / 50.0, 51, states);
+
+    ASSERT_EQ(states.size(), 51U);
+    for (std::size_t i = 0; i + 1 < states.size(); ++i)
+    {
+        const auto chord = norm(states[i + 1].position - states[i].position);
+        EXPECT_NEAR(chord, length(desc) / 50.0, 1e-3);
+    }
+    EXPECT_NEAR(states.back().position.x, 5.0, 1e-12);
+    EXPECT_NEAR(states.back().position.y, 0.0, 1e-12);
+}
+
+TEST(PathDescriptorTest, trivially_copyable_and_compact)
+{
+    using namespace dubins;
+
+    static_assert(std::is_trivially_copyable_v<PathDescriptor>);
+    EXPECT_LE(sizeof(PathDescriptor), 64U);
+
+    // Copies are plain memory copies
+    const auto     desc = shortest_path({{1.0, 2.0}, 0.3}, {{-4.0, 5.0}, 2.0}, 1.2);
+    PathDescriptor copy;
+    std::memcpy(&copy, &desc, sizeof(desc));
+    EXPECT_EQ(copy.word, desc.word);
+    EXPECT_EQ(length(copy), length(desc));
+}
+
+TEST(PathDescriptorTest, encode_decode)
+{
+    using namespace dubins;
+
+    const auto desc = shortest_path({{1.0, 2.0}, 0.3}, {{-4.0, 5.0}, 2.0}, 1.2);
+    const auto data = encode(desc);
+
+    // Layout is fixed: little-endian doubles then the word
+    EXPECT_EQ(data.size(), encoded_descriptor_size);
+    const auto one = encode(PathDescriptor{{{1.0, 0.0}, 0.0}, 1.0, {0.0, 0.0, 0.0}, Word::RLR});
+    const std::array<std::uint8_t, 8> expected_one{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F};
+    EXPECT_TRUE(std::equal(expected_one.begin(), expected_one.end(), one.begin()));
+    EXPECT_EQ(one[56], 5U);
+
+    const auto decoded = decode(data.data());
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->start.position.x, desc.start.position.x);
+    EXPECT_EQ(decoded->start.position.y, desc.start.position.y);
+    EXPECT_EQ(decoded->start.heading, desc.start.heading);
+    EXPECT_EQ(decoded->radius, desc.radius);
+    EXPECT_EQ(decoded->segments, desc.segments);
+    EXPECT_EQ(decoded->word, desc.word);
+
+    auto invalid = data;
+    invalid[56]  = 6;
+    EXPECT_FALSE(decode(invalid.data()).has_value());
+}
+
+TEST(PathDescriptorTest, dubins_descriptor)
+{
+    using namespace dubins;
+
+    Dubins::Options opt;
+    opt.turning_radius         = 2.0;
+    opt.max_segment_length     = 0.1;
+    opt.min_number_of_segments = 20;
+
+    State start{{0.0, 0.0}, M_PI_2};
+    State end{{4.0, 4.0}, M_PI_2};
+
+    Dubins     path{start, end, opt};
+    const auto desc = path.descriptor();
+
+    EXPECT_EQ(desc.word, Word::RSL);
+    EXPECT_NEAR(length(desc), path.length(), 1e-12);
+
+    // Sampling from the descriptor covers the same path
+    const auto segments = segmented_path(desc, opt);
+    ASSERT_EQ(segments.size(), static_cast<std::size_t>(std::ceil(path.length() / 0.1)) + 1);
+    EXPECT_NEAR(segments.front().position.x, start.position.x, 1e-12);
+    EXPECT_NEAR(segments.front().position.y, start.position.y, 1e-12);
+    EXPECT_NEAR(segments.back().position.x, end.position.x, 1e-12);
+    EXPECT_NEAR(segments.back().position.y, end.position.y, 1e-12);
+    EXPECT_NEAR(segments.back().heading, end.heading, 1e-12);
+}
+
+TEST(PathDescriptorTest, memory_resource)
+{
+    using namespace dubins;
+
+    Dubins::Options opt;
+    opt.turning_radius         = 1.5;
+    opt.max_segment_length     = 0.05;
+    opt.min_number_of_segments = 10;
+
+    const auto desc     = shortest_path({{0.0, 0.0}, 0.0}, {{3.0, -2.0}, 2.0}, opt.turning_radius);
+    const auto expected = segmented_path(desc, opt);
+
+    std::array<std::byte, 1 << 16>      buffer;
+    std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+    const auto segments = segmented_path(desc, opt, &arena);
+    ASSERT_EQ(segments.size(), expected.size());
+    for (std::size_t i = 0; i < segments.size(); ++i)
+    {
+        EXPECT_EQ(segments[i].position.x, expected[i].position.x);
+        EXPECT_EQ(segments[i].position.y, expected[i].position.y);
+        EXPECT_EQ(segments[i].heading, expected[i].heading);
+    }
+}
+
+TEST(PathDescriptorTest, adaptive_path)
+{
+    using namespace dubins;
+
+    const double radius    = 2.0;
+    const double max_error = 0.01;
+
+    // Two quarter turns joined by a long straight line
+    const auto desc   = shortest_path({{0.0, 0.0}, 0.0}, {{50.0, 20.0}, 0.0}, radius);
+    const auto states = adaptive_path(desc, max_error);
+
+    // Each arc needs ceil(angle / (2 acos(1 - e / r))) chords, the line a single one
+    const auto max_angle = 2.0 * std::acos(1.0 - max_error / radius);
+    const auto expected  = std::ceil(desc.segments[0] / radius / max_angle) + 1.0 +
+                           std::ceil(desc.segments[2] / radius / max_angle) + 1.0;
+    EXPECT_EQ(states.size(), static_cast<std::size_t>(expected));
+
+    Dubins::Options opt;
+    opt.turning_radius = radius;
+    EXPECT_LT(5 * states.size(), segmented_path(desc, opt).size());
+
+    const auto end = end_state(desc);
+    EXPECT_NEAR(states.front().position.x, 0.0, 1e-12);
+    EXPECT_NEAR(states.back().position.x, end.position.x, 1e-12);
+    EXPECT_NEAR(states.back().position.y, end.position.y, 1e-12);
+    EXPECT_NEAR(states.back().heading, end.heading, 1e-12);
+
+    // Every point of the path lies within the error bound of the polyline
+    const auto distance_to_polyline = [&](const Vector2D& p) {
+        double best = std::numeric_limits<double>::infinity();
+        for (std::size_t i = 0; i + 1 < states.size(); ++i)
+        {
+            const auto a = states[i].position;
+            const auto d = states[i + 1].position - a;
+            const auto t = std::clamp(inner(p - a, d) / std::max(norm_sq(d), 1e-300), 0.0, 1.0);
+            best         = std::min(best, norm(a + t * d - p));
+        }
+        return best;
+    };
+
+    for (double s = 0.0; s <= length(desc); s += 0.01)
+    {
+        EXPECT_LE(distance_to_polyline(state_at(desc, s).position), max_error * (1.0 + 1e-9));
+    }
+
+    // No error bound can be met without a positive tolerance
+    EXPECT_TRUE(adaptive_path(desc, 0.0).empty());
+    EXPECT_TRUE(adaptive_path(desc, -1.0).empty());
+    EXPECT_TRUE(adaptive_path(desc, std::numeric_limits<double>::quiet_NaN()).empty());
+}
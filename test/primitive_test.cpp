@@ -0,0 +1,74 @@
+#include "dubins/Dubins.hpp"
+#include "dubins/Primitive.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <variant>
+
+
+namespace
+{
+dubins::Vector2D start_point(const dubins::Primitive& primitive)
+{
+    if (const auto* arc = std::get_if<dubins::ArcPrimitive>(&primitive))
+    {
+        return arc->center + arc->radius * dubins::Vector2D{std::cos(arc->start_angle), std::sin(arc->start_angle)};
+    }
+    return std::get<dubins::Line2D>(primitive).a;
+}
+
+dubins::Vector2D end_point(const dubins::Primitive& primitive)
+{
+    if (const auto* arc = std::get_if<dubins::ArcPrimitive>(&primitive))
+    {
+        return arc->center + arc->radius * dubins::Vector2D{std::cos(arc->end_angle), std::sin(arc->end_angle)};
+    }
+    return std::get<dubins::Line2D>(primitive).b;
+}
+
+}    // namespace
+
+TEST(PrimitiveTest, matches_path)
+{
+    using namespace dubins;
+
+    Dubins::Options opt;
+    opt.turning_radius = 2.0;
+
+    const State starts[] = {{{0.0, 0.0}, M_PI_2}, {{0.0, 0.0}, -M_PI_2}, {{0.0, 0.0}, M_PI_2}, {{0.0, 0.0}, 0.0}};
+    const State ends[]   = {{{5.0, 0.0}, -M_PI_2}, {{5.0, 0.0}, M_PI_2}, {{4.0, 4.0}, M_PI_2}, {{1.0, 1.0}, M_PI}};
+
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        Dubins     path{starts[i], ends[i], opt};
+        const auto desc = path.descriptor();
+
+        const auto from_path       = path.primitives();
+        const auto from_descriptor = primitives(desc);
+        const auto types           = segment_types(desc.word);
+
+        double total = 0.0;
+        for (std::size_t j = 0; j < 3; ++j)
+        {
+            EXPECT_EQ(std::holds_alternative<Line2D>(from_path[j]), types[j] == SegmentType::straight);
+            EXPECT_EQ(from_path[j].index(), from_descriptor[j].index());
+            EXPECT_NEAR(length(from_path[j]), desc.segments[j], 1e-9);
+            EXPECT_NEAR(length(from_descriptor[j]), desc.segments[j], 1e-9);
+            EXPECT_NEAR(norm(end_point(from_path[j]) - end_point(from_descriptor[j])), 0.0, 1e-9);
+            total += length(from_path[j]);
+
+            if (const auto* arc = std::get_if<ArcPrimitive>(&from_path[j]))
+            {
+                EXPECT_EQ(arc->direction, types[j]);
+                EXPECT_EQ(arc->sweep >= 0.0, types[j] == SegmentType::left);
+            }
+        }
+        EXPECT_NEAR(total, path.length(), 1e-9);
+
+        // Primitives chain from the start state to the end state
+        EXPECT_NEAR(norm(start_point(from_path[0]) - starts[i].position), 0.0, 1e-9);
+        EXPECT_NEAR(norm(start_point(from_path[1]) - end_point(from_path[0])), 0.0, 1e-9);
+        EXPECT_NEAR(norm(start_point(from_path[2]) - end_point(from_path[1])), 0.0, 1e-9);
+        EXPECT_NEAR(norm(end_point(from_path[2]) - ends[i].position), 0.0, 1e-9);
+    }
+}
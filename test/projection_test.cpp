@@ -0,0 +1,110 @@
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Projection.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+// Closest point by dense sampling
+double brute_force_distance(const dubins::PathDescriptor& path, const dubins::Vector2D& point)
+{
+    const auto len  = dubins::length(path);
+    double     best = std::numeric_limits<double>::infinity();
+    for (int i = 0; i <= 20000; ++i)
+    {
+        const auto state = dubins::state_at(path, len * i / 20000.0);
+        best             = std::min(best, norm(state.position - point));
+    }
+    return best;
+}
+}    // namespace
+
+TEST(ProjectionTest, matches_dense_search)
+{
+    using namespace dubins;
+
+    std::mt19937                           gen{7};
+    std::uniform_real_distribution<double> dist{-6.0, 6.0};
+
+    for (int i = 0; i < 50; ++i)
+    {
+        const State start{{dist(gen), dist(gen)}, dist(gen)};
+        const State end{{dist(gen), dist(gen)}, dist(gen)};
+        const auto  path  = shortest_path(start, end, 1.5);
+        const auto  point = Vector2D{dist(gen), dist(gen)};
+
+        const auto result = project(path, point);
+        const auto state  = state_at(path, result.arc_length);
+
+        EXPECT_NEAR(result.distance, norm(state.position - point), 1e-9);
+        EXPECT_NEAR(result.distance, brute_force_distance(path, point), 1e-3);
+    }
+}
+
+TEST(ProjectionTest, points_on_path)
+{
+    using namespace dubins;
+
+    const auto path = shortest_path({{0.0, 0.0}, 0.0}, {{4.0, 4.0}, M_PI}, 1.0);
+
+    for (double s = 0.0; s <= length(path); s += 0.05)
+    {
+        const auto result = project(path, state_at(path, s).position);
+        EXPECT_NEAR(result.distance, 0.0, 1e-9);
+        EXPECT_NEAR(result.arc_length, s, 1e-6);
+    }
+}
+
+TEST(ProjectionTest, warm_start_tracks_through_loop)
+{
+    using namespace dubins;
+
+    // End just behind the start, the path loops back past the start point
+    const auto path = shortest_path({{0.0, 0.0}, 0.0}, {{-0.5, 0.0}, 0.0}, 1.0);
+    const auto len  = length(path);
+
+    Projection previous{0.0, 0.0};
+    for (double s = 0.0; s <= len; s += 0.01)
+    {
+        const auto point = state_at(path, s).position + Vector2D{0.0, 0.01};
+        previous         = project(path, point, previous.arc_length, 0.5);
+        EXPECT_NEAR(previous.arc_length, s, 0.05);
+    }
+}
+
+TEST(ProjectionTest, batch)
+{
+    using namespace dubins;
+
+    std::vector<PathDescriptor> paths;
+    std::vector<Vector2D>       points;
+    for (int i = 0; i < 100; ++i)
+    {
+        paths.push_back(shortest_path({{0.0, double(i)}, 0.1 * i}, {{5.0, -double(i)}, -0.2 * i}, 1.0));
+        points.push_back({0.05 * i, 0.0});
+    }
+
+    std::vector<Projection> out;
+    project(paths, points, out, 4);
+
+    ASSERT_EQ(out.size(), paths.size());
+    for (std::size_t i = 0; i < paths.size(); ++i)
+    {
+        const auto expected = project(paths[i], points[i]);
+        EXPECT_DOUBLE_EQ(out[i].arc_length, expected.arc_length);
+        EXPECT_DOUBLE_EQ(out[i].distance, expected.distance);
+    }
+
+    // Warm started batch from the exact results stays put
+    auto warm = out;
+    project(paths, points, 0.5, warm, 4);
+    for (std::size_t i = 0; i < paths.size(); ++i)
+    {
+        EXPECT_NEAR(warm[i].arc_length, out[i].arc_length, 1e-12);
+    }
+}
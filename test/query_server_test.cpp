@@ -0,0 +1,224 @@
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/QueryServer.hpp"
+#include "random_inputs.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+
+TEST(QueryServerTest, protocol_round_trip)
+{
+    using namespace dubins;
+
+    QueryRequest request;
+    request.id      = 0xdeadbeef;
+    request.type    = QueryType::samples;
+    request.start   = {{1.5, -2.0}, 0.25};
+    request.end     = {{-3.0, 4.0}, -1.0};
+    request.radius  = 1.25;
+    request.spacing = 0.05;
+
+    const auto data    = encode(request);
+    const auto decoded = decode_request(data.data());
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->id, request.id);
+    EXPECT_EQ(decoded->type, request.type);
+    EXPECT_EQ(decoded->start.position.x, request.start.position.x);
+    EXPECT_EQ(decoded->end.heading, request.end.heading);
+    EXPECT_EQ(decoded->radius, request.radius);
+    EXPECT_EQ(decoded->spacing, request.spacing);
+
+    auto bad = data;
+    bad[4]   = 7;
+    EXPECT_FALSE(decode_request(bad.data()).has_value());
+
+    QueryResponse response;
+    response.id      = 42;
+    response.length  = 3.5;
+    response.samples = {request.start, request.end};
+
+    std::vector<std::uint8_t> buffer;
+    encode(response, buffer);
+    ASSERT_EQ(buffer.size(), query_response_header_size + 2 * query_sample_size);
+    EXPECT_EQ(response_size(buffer.data()), buffer.size());
+
+    const auto back = decode_response(buffer.data(), buffer.size());
+    ASSERT_TRUE(back.has_value());
+    EXPECT_EQ(back->id, 42u);
+    EXPECT_EQ(back->status, QueryStatus::ok);
+    EXPECT_EQ(back->length, 3.5);
+    ASSERT_EQ(back->samples.size(), 2u);
+    EXPECT_EQ(back->samples[1].position.y, 4.0);
+    EXPECT_FALSE(decode_response(buffer.data(), buffer.size() - 1).has_value());
+}
+
+TEST(QueryServerTest, answers_queries)
+{
+    using namespace dubins;
+
+    QueryServer::Options options;
+    options.socket_path = testing::TempDir() + "dubins_query_server_test.sock";
+    options.threads     = 2;
+
+    auto server = QueryServer::start(options);
+    ASSERT_TRUE(server.has_value());
+
+    auto client = QueryClient::connect(options.socket_path);
+    ASSERT_TRUE(client.has_value());
+
+    const auto starts = random_states(20, 1);
+    const auto ends   = random_states(20, 2);
+    for (std::size_t i = 0; i < starts.size(); ++i)
+    {
+        const auto expected = shortest_path(starts[i], ends[i], 1.2);
+
+        const auto len = client->length(starts[i], ends[i], 1.2);
+        ASSERT_TRUE(len.has_value());
+        EXPECT_NEAR(*len, length(expected), 1e-9);
+
+        const auto samples = client->samples(starts[i], ends[i], 1.2, 0.1);
+        ASSERT_TRUE(samples.has_value());
+        ASSERT_GE(samples->size(), 2u);
+        EXPECT_GE(samples->size(), static_cast<std::size_t>(length(expected) / 0.1));
+        EXPECT_NEAR(samples->front().position.x, starts[i].position.x, 1e-9);
+        EXPECT_NEAR(samples->back().position.x, ends[i].position.x, 1e-8);
+        EXPECT_NEAR(samples->back().position.y, ends[i].position.y, 1e-8);
+    }
+
+    // Rejected queries are answered, not dropped
+    EXPECT_FALSE(client->length(starts[0], ends[0], -1.0).has_value());
+    EXPECT_FALSE(client->samples(starts[0], ends[0], 1.0, 0.0).has_value());
+    EXPECT_TRUE(client->length(starts[0], ends[0], 1.0).has_value());
+
+    // Responses are sent before they are counted, stopping waits for the batch in progress
+    server->stop();
+    const auto metrics = server->metrics();
+    EXPECT_EQ(metrics.requests, 2 * starts.size() + 3);
+    EXPECT_EQ(metrics.invalid, 2u);
+    EXPECT_EQ(metrics.connections, 1u);
+    EXPECT_GT(metrics.throughput, 0.0);
+    EXPECT_GT(metrics.latency_max, 0.0);
+    EXPECT_LE(metrics.latency_p50, metrics.latency_max);
+
+    // Stopping removes the socket
+    EXPECT_FALSE(std::ifstream{options.socket_path}.good());
+    EXPECT_FALSE(QueryClient::connect(options.socket_path).has_value());
+}
+
+TEST(QueryServerTest, coalesces_concurrent_clients)
+{
+    using namespace dubins;
+
+    QueryServer::Options options;
+    options.socket_path = testing::TempDir() + "dubins_query_server_batch_test.sock";
+    options.max_latency = std::chrono::milliseconds(2);
+
+    auto server = QueryServer::start(options);
+    ASSERT_TRUE(server.has_value());
+
+    // Several clients pipeline queries from a shared start, as a planner fanning out to its goals would
+    constexpr std::size_t clients  = 4;
+    constexpr std::size_t requests = 500;
+    const State           start{{0.5, 0.5}, 0.3};
+    const auto            goals = random_states(requests, 3);
+
+    std::vector<std::thread> threads;
+    std::vector<std::size_t> correct(clients, 0);
+    for (std::size_t c = 0; c < clients; ++c)
+    {
+        threads.emplace_back([&, c]() {
+            auto client = QueryClient::connect(options.socket_path);
+            if (!client)
+            {
+                return;
+            }
+
+            for (std::size_t i = 0; i < requests; ++i)
+            {
+                QueryRequest request;
+                request.id     = static_cast<std::uint32_t>(i);
+                request.start  = start;
+                request.end    = goals[i];
+                request.radius = 1.0;
+                client->send(request);
+            }
+            for (std::size_t i = 0; i < requests; ++i)
+            {
+                const auto response = client->receive();
+                if (!response || response->id >= requests)
+                {
+                    return;
+                }
+                const auto expected = length(shortest_path(start, goals[response->id], 1.0));
+                correct[c] += std::abs(response->length - expected) < 1e-9;
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const auto count : correct)
+    {
+        EXPECT_EQ(count, requests);
+    }
+
+    server->stop();
+    const auto metrics = server->metrics();
+    EXPECT_EQ(metrics.requests, clients * requests);
+    EXPECT_EQ(metrics.connections, clients);
+    EXPECT_LT(metrics.batches, metrics.requests / 10);
+    EXPECT_GT(metrics.mean_batch_size, 10.0);
+}
+
+TEST(QueryServerTest, socket_path_ownership)
+{
+    using namespace dubins;
+
+    QueryServer::Options options;
+    options.socket_path = testing::TempDir() + "dubins_query_server_path_test.sock";
+    std::remove(options.socket_path.c_str());
+
+    // A file that is not a socket is never replaced
+    std::ofstream{options.socket_path} << "data";
+    EXPECT_FALSE(QueryServer::start(options).has_value());
+    EXPECT_TRUE(std::ifstream{options.socket_path}.good());
+    std::remove(options.socket_path.c_str());
+
+    // A socket left behind by a process that exited is
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, options.socket_path.c_str(), sizeof(address.sun_path) - 1);
+    const auto stale = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_EQ(::bind(stale, reinterpret_cast<const sockaddr*>(&address), sizeof(address)), 0);
+    ::close(stale);
+
+    auto first = QueryServer::start(options);
+    ASSERT_TRUE(first.has_value());
+
+    // A live server keeps its socket
+    EXPECT_FALSE(QueryServer::start(options).has_value());
+    EXPECT_TRUE(QueryClient::connect(options.socket_path).has_value());
+
+    // A server that lost its path to another does not remove the other's socket when it stops
+    std::remove(options.socket_path.c_str());
+    auto second = QueryServer::start(options);
+    ASSERT_TRUE(second.has_value());
+    first->stop();
+
+    auto client = QueryClient::connect(options.socket_path);
+    ASSERT_TRUE(client.has_value());
+    EXPECT_TRUE(client->length({{0.0, 0.0}, 0.0}, {{3.0, 1.0}, 1.0}, 1.0).has_value());
+
+    second->stop();
+    EXPECT_FALSE(std::ifstream{options.socket_path}.good());
+}
@@ -0,0 +1,63 @@
+#ifndef DUBINS_TEST_RANDOM_INPUTS_HPP
+#define DUBINS_TEST_RANDOM_INPUTS_HPP
+
+#include "dubins/Circle.hpp"
+#include "dubins/State.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+/// @brief Get a state with uniformly distributed position and heading
+/// @param gen random generator
+/// @param extent position lies within [-extent, extent] on both axes
+/// @return state
+inline dubins::State random_state(std::mt19937& gen, double extent = 6.0)
+{
+    std::uniform_real_distribution<double> pos(-extent, extent);
+    std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+
+    const auto x = pos(gen);
+    const auto y = pos(gen);
+    return {{x, y}, heading(gen)};
+}
+
+/// @brief Get states with uniformly distributed positions and headings
+/// @param count number of states
+/// @param seed seed of the generator, equal seeds give equal states
+/// @param extent positions lie within [-extent, extent] on both axes
+/// @return states
+inline std::vector<dubins::State> random_states(std::size_t count, unsigned seed, double extent = 6.0)
+{
+    std::mt19937 gen(seed);
+
+    std::vector<dubins::State> states;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        states.push_back(random_state(gen, extent));
+    }
+    return states;
+}
+
+/// @brief Get circles with uniformly distributed centers and radii
+/// @param gen random generator
+/// @param n number of circles
+/// @return circles
+inline dubins::Circles random_circles(std::mt19937& gen, std::size_t n)
+{
+    std::uniform_real_distribution<double> pos(-5.0, 5.0);
+    std::uniform_real_distribution<double> radius(0.1, 3.0);
+
+    dubins::Circles circles;
+    circles.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        circles.x[i]      = pos(gen);
+        circles.y[i]      = pos(gen);
+        circles.radius[i] = radius(gen);
+    }
+    return circles;
+}
+
+#endif    // DUBINS_TEST_RANDOM_INPUTS_HPP
@@ -0,0 +1,148 @@
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Raster.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+
+TEST(RasterTest, line)
+{
+    using namespace dubins;
+
+    Grid grid;
+    grid.resolution = 1.0;
+    grid.width      = 10;
+    grid.height     = 10;
+
+    // Straight path along a row, starting and ending inside cells
+    PathDescriptor path;
+    path.start    = {{0.5, 2.5}, 0.0};
+    path.word     = Word::LSL;
+    path.segments = {0.0, 4.0, 0.0};
+
+    const auto cells = rasterize(path, grid);
+    ASSERT_EQ(cells.size(), 5U);
+    for (std::int32_t i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(cells[i], (Cell{i, 2}));
+    }
+}
+
+TEST(RasterTest, far_from_grid)
+{
+    using namespace dubins;
+
+    Grid grid;
+    grid.width  = 10;
+    grid.height = 10;
+
+    // Cell indices of these points do not fit in 32 bits
+    PathDescriptor path;
+    path.start    = {{3.0e9, 2.5}, 0.0};
+    path.word     = Word::LSL;
+    path.segments = {0.0, 4.0, 0.0};
+    EXPECT_TRUE(rasterize(path, grid).empty());
+
+    path.start    = {{-3.0e9, -7.0e12}, 1.0};
+    path.word     = Word::RSL;
+    path.segments = {1.0, 2.0, 3.0};
+    EXPECT_TRUE(rasterize(path, grid).empty());
+    EXPECT_FALSE(first_occupied(path, grid, std::vector<std::uint8_t>(100, 1).data()).has_value());
+}
+
+TEST(RasterTest, matches_sampled_path)
+{
+    using namespace dubins;
+
+    Grid grid;
+    grid.origin     = {-12.0, -12.0};
+    grid.resolution = 0.37;
+    grid.width      = 65;
+    grid.height     = 65;
+
+    std::mt19937                           gen(3);
+    std::uniform_real_distribution<double> pos(-6.0, 6.0);
+    std::uniform_real_distribution<double> heading(-M_PI, M_PI);
+
+    for (int n = 0; n < 50; ++n)
+    {
+        const auto path = shortest_path({{pos(gen), pos(gen)}, heading(gen)},
+                                        {{pos(gen), pos(gen)}, heading(gen)}, 1.3);
+        const auto cells = rasterize(path, grid);
+
+        std::set<std::pair<int, int>> unique;
+        for (const auto& cell : cells)
+        {
+            EXPECT_TRUE(unique.insert({cell.x, cell.y}).second) << "cell visited twice";
+        }
+
+        // Every sampled point lies in a visited cell
+        const auto len   = length(path);
+        const auto steps = 20000;
+        for (int k = 0; k <= steps; ++k)
+        {
+            const auto p = (state_at(path, len * k / steps).position - grid.origin) / grid.resolution;
+            const auto x = std::floor(p.x);
+            const auto y = std::floor(p.y);
+
+            // Points on a grid line belong to both sides
+            if (std::abs(p.x - std::round(p.x)) < 1e-9 || std::abs(p.y - std::round(p.y)) < 1e-9)
+            {
+                continue;
+            }
+            EXPECT_EQ(unique.count({int(x), int(y)}), 1U);
+        }
+
+        // Every visited cell is touched by the path
+        for (const auto& cell : cells)
+        {
+            double closest = std::numeric_limits<double>::infinity();
+            for (int k = 0; k <= steps; ++k)
+            {
+                const auto p  = (state_at(path, len * k / steps).position - grid.origin) / grid.resolution;
+                const auto dx = std::max({double(cell.x) - p.x, 0.0, p.x - double(cell.x + 1)});
+                const auto dy = std::max({double(cell.y) - p.y, 0.0, p.y - double(cell.y + 1)});
+                closest       = std::min(closest, std::hypot(dx, dy));
+            }
+            EXPECT_LT(closest * grid.resolution, 2.0 * len / steps);
+        }
+    }
+}
+
+TEST(RasterTest, first_occupied)
+{
+    using namespace dubins;
+
+    Grid grid;
+    grid.resolution = 0.5;
+    grid.width      = 40;
+    grid.height     = 40;
+
+    const auto path  = shortest_path({{2.0, 2.0}, 0.0}, {{15.0, 12.0}, M_PI_2}, 2.0);
+    const auto cells = rasterize(path, grid);
+    ASSERT_GT(cells.size(), 10U);
+
+    std::vector<std::uint8_t> occupancy(std::size_t(grid.width * grid.height), 0);
+    EXPECT_FALSE(first_occupied(path, grid, occupancy.data()).has_value());
+
+    // Block two cells along the path, the first one in order of travel is reported
+    const auto a = cells[cells.size() / 2];
+    const auto b = cells[cells.size() / 3];
+    occupancy[std::size_t(a.y * grid.width + a.x)] = 1;
+    occupancy[std::size_t(b.y * grid.width + b.x)] = 1;
+
+    const auto hit = first_occupied(path, grid, occupancy.data());
+    ASSERT_TRUE(hit.has_value());
+    EXPECT_EQ(hit.value(), b);
+
+    // The traversal stops at the first cell the visitor rejects
+    std::size_t visited = 0;
+    EXPECT_FALSE(traverse(path, grid, [&](const Cell&) { return ++visited < 5; }));
+    EXPECT_EQ(visited, 5U);
+}
@@ -0,0 +1,105 @@
+#include "dubins/PathDescriptor.hpp"
+#include "dubins/Replanner.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+
+
+namespace
+{
+void random_walk(bool move_start, bool move_end, double step, std::uint32_t seed)
+{
+    using namespace dubins;
+
+    std::mt19937                           gen{seed};
+    std::uniform_real_distribution<double> dist{-1.0, 1.0};
+
+    State  start{{0.0, 0.0}, 0.0};
+    State  end{{3.0, 1.0}, 2.0};
+    double radius = 1.0;
+
+    Replanner replanner{start, end, radius};
+
+    std::size_t switches = 0;
+    const int   ticks    = 5000;
+    for (int tick = 0; tick < ticks; ++tick)
+    {
+        if (move_start)
+        {
+            start.position = start.position + step * Vector2D{dist(gen), dist(gen)};
+            start.heading += step * dist(gen);
+        }
+        if (move_end)
+        {
+            end.position = end.position + step * Vector2D{dist(gen), dist(gen)};
+            end.heading += step * dist(gen);
+        }
+
+        const auto previous = replanner.word();
+        const auto switched = replanner.update(start, end);
+        const auto expected = shortest_path(start, end, radius);
+
+        ASSERT_NEAR(replanner.length(), length(expected), 1e-9) << "tick " << tick;
+        EXPECT_EQ(switched, replanner.word() != previous);
+        switches += switched ? 1 : 0;
+    }
+
+    // The walk changes the optimal word, but most ticks should not need a full evaluation
+    EXPECT_GT(switches, 0U);
+    EXPECT_LT(replanner.full_evaluations(), std::size_t(ticks));
+}
+}    // namespace
+
+TEST(ReplannerTest, matches_fresh_solution_start_drift)
+{
+    random_walk(true, false, 0.01, 1);
+}
+
+TEST(ReplannerTest, matches_fresh_solution_end_drift)
+{
+    random_walk(false, true, 0.01, 2);
+}
+
+TEST(ReplannerTest, matches_fresh_solution_both_drift)
+{
+    random_walk(true, true, 0.02, 3);
+}
+
+TEST(ReplannerTest, word_switch_reported)
+{
+    using namespace dubins;
+
+    // Sweep the goal from the right of the start to the left of it
+    State start{{0.0, 0.0}, M_PI_2};
+    State end{{4.0, 4.0}, M_PI_2};
+
+    Replanner replanner{start, end, 2.0};
+    EXPECT_EQ(replanner.word(), Word::RSL);
+
+    bool switched = false;
+    for (double x = 4.0; x >= -4.0; x -= 0.01)
+    {
+        end.position.x = x;
+        switched |= replanner.update_end(end);
+    }
+
+    EXPECT_TRUE(switched);
+    EXPECT_EQ(replanner.word(), Word::LSR);
+    EXPECT_NEAR(replanner.length(), length(shortest_path(start, end, 2.0)), 1e-9);
+}
+
+TEST(ReplannerTest, stationary_update_is_cheap)
+{
+    using namespace dubins;
+
+    State start{{0.0, 0.0}, 0.3};
+    State end{{10.0, -2.0}, 1.0};
+
+    Replanner replanner{start, end, 1.0};
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_FALSE(replanner.update_start(start));
+    }
+    EXPECT_EQ(replanner.full_evaluations(), 1U);
+}
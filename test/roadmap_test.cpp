@@ -0,0 +1,182 @@
+#include "dubins/Roadmap.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <gtest/gtest.h>
+#include <limits>
+#include <queue>
+#include <vector>
+
+
+namespace
+{
+// Reference shortest route length with Dijkstra
+double dijkstra(const dubins::Roadmap& roadmap, std::uint32_t start, std::uint32_t goal)
+{
+    using Entry = std::pair<double, std::uint32_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+    std::vector<double> cost(roadmap.size(), std::numeric_limits<double>::infinity());
+
+    cost[start] = 0.0;
+    open.push({0.0, start});
+    while (!open.empty())
+    {
+        const auto [g, node] = open.top();
+        open.pop();
+        if (g > cost[node])
+        {
+            continue;
+        }
+
+        const auto [first, last] = roadmap.edges(node);
+        for (auto edge = first; edge != last; ++edge)
+        {
+            if (g + edge->length() < cost[edge->to])
+            {
+                cost[edge->to] = g + edge->length();
+                open.push({cost[edge->to], edge->to});
+            }
+        }
+    }
+    return cost[goal];
+}
+
+}    // namespace
+
+TEST(RoadmapTest, nearest_neighbours)
+{
+    using namespace dubins;
+
+    Roadmap::Options options;
+    options.region         = {{0.0, 0.0}, {20.0, 10.0}};
+    options.nodes          = 300;
+    options.neighbours     = 6;
+    options.turning_radius = 1.5;
+    options.seed           = 4;
+    options.threads        = 3;
+
+    const Roadmap roadmap{options};
+    ASSERT_EQ(roadmap.size(), 300u);
+    EXPECT_EQ(roadmap.edge_count(), 300u * 6u);
+
+    // Without obstacles every node is connected to exactly its k nearest nodes by path length
+    for (std::uint32_t i = 0; i < roadmap.size(); ++i)
+    {
+        std::vector<double> lengths;
+        for (std::uint32_t j = 0; j < roadmap.size(); ++j)
+        {
+            if (j != i)
+            {
+                lengths.push_back(length(shortest_path(roadmap.node(i), roadmap.node(j), options.turning_radius)));
+            }
+        }
+        std::sort(lengths.begin(), lengths.end());
+
+        const auto [first, last] = roadmap.edges(i);
+        ASSERT_EQ(last - first, 6);
+        for (auto edge = first; edge != last; ++edge)
+        {
+            EXPECT_NE(edge->to, i);
+            EXPECT_NEAR(edge->length(), lengths[std::size_t(edge - first)], 1e-4);
+        }
+    }
+}
+
+TEST(RoadmapTest, obstacles)
+{
+    using namespace dubins;
+
+    const std::vector<Circle> obstacles{{{5.0, 5.0}, 2.0}, {{12.0, 3.0}, 1.5}, {{15.0, 8.0}, 2.5}};
+
+    Roadmap::Options options;
+    options.region         = {{0.0, 0.0}, {20.0, 10.0}};
+    options.nodes          = 400;
+    options.neighbours     = 8;
+    options.turning_radius = 1.0;
+    options.threads        = 2;
+
+    const Roadmap roadmap{options, obstacles};
+    ASSERT_EQ(roadmap.size(), 400u);
+
+    for (std::uint32_t i = 0; i < roadmap.size(); ++i)
+    {
+        for (const auto& obstacle : obstacles)
+        {
+            EXPECT_GE(norm(roadmap.node(i).position - obstacle.center), obstacle.radius);
+        }
+
+        const auto [first, last] = roadmap.edges(i);
+        for (auto edge = first; edge != last; ++edge)
+        {
+            const auto path = roadmap.path(i, *edge);
+            EXPECT_FALSE(collides(path, obstacles));
+
+            std::vector<State> states;
+            sample(path, 0.0, 0.05, std::size_t(length(path) / 0.05), states);
+            for (const auto& state : states)
+            {
+                for (const auto& obstacle : obstacles)
+                {
+                    EXPECT_GE(norm(state.position - obstacle.center), obstacle.radius - 1e-6);
+                }
+            }
+        }
+    }
+
+    // A straight path through an obstacle collides, one passing beside it does not
+    const PathDescriptor through{{{0.0, 5.0}, 0.0}, 1.0, {0.0, 10.0, 0.0}, Word::LSL};
+    const PathDescriptor beside{{{0.0, 7.5}, 0.0}, 1.0, {0.0, 10.0, 0.0}, Word::LSL};
+    EXPECT_TRUE(collides(through, obstacles));
+    EXPECT_FALSE(collides(beside, obstacles));
+}
+
+TEST(RoadmapTest, query)
+{
+    using namespace dubins;
+
+    Roadmap::Options options;
+    options.region         = {{0.0, 0.0}, {30.0, 30.0}};
+    options.nodes          = 500;
+    options.neighbours     = 8;
+    options.turning_radius = 1.0;
+    options.seed           = 12;
+
+    const Roadmap roadmap{options, {{{15.0, 15.0}, 5.0}}};
+
+    for (std::uint32_t goal = 1; goal < 40; goal += 3)
+    {
+        const auto route    = roadmap.query(0, goal);
+        const auto expected = dijkstra(roadmap, 0, goal);
+        if (std::isinf(expected))
+        {
+            EXPECT_TRUE(route.nodes.empty());
+            continue;
+        }
+
+        ASSERT_FALSE(route.nodes.empty());
+        EXPECT_EQ(route.nodes.front(), 0u);
+        EXPECT_EQ(route.nodes.back(), goal);
+        EXPECT_NEAR(route.length, expected, 1e-6 * expected);
+
+        // The edge paths chain from node to node
+        const auto paths = roadmap.paths(route);
+        ASSERT_EQ(paths.size(), route.nodes.size() - 1);
+        for (std::size_t i = 0; i < paths.size(); ++i)
+        {
+            const auto end = end_state(paths[i]);
+            EXPECT_NEAR(end.position.x, roadmap.node(route.nodes[i + 1]).position.x, 1e-4);
+            EXPECT_NEAR(end.position.y, roadmap.node(route.nodes[i + 1]).position.y, 1e-4);
+        }
+    }
+
+    // Two clusters further apart than the longest connection can not reach each other
+    Roadmap::Options short_options;
+    short_options.neighbours = 3;
+    short_options.max_length = 10.0;
+
+    const Roadmap split{{{{0.0, 0.0}, 0.0}, {{1.0, 0.0}, 0.0}, {{2.0, 0.0}, 0.0}, {{100.0, 0.0}, 0.0}}, short_options};
+    EXPECT_FALSE(split.query(0, 2).nodes.empty());
+    EXPECT_TRUE(split.query(0, 3).nodes.empty());
+    EXPECT_TRUE(std::isinf(split.query(0, 3).length));
+}
@@ -0,0 +1,141 @@
+#include "dubins/Dubins.hpp"
+#include "dubins/Route.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+
+namespace
+{
+std::vector<dubins::State> make_waypoints(std::size_t n)
+{
+    std::vector<dubins::State> waypoints;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const double t = double(i);
+        waypoints.push_back({{4.0 * t, 3.0 * std::sin(t)}, 0.5 * std::cos(1.3 * t)});
+    }
+    return waypoints;
+}
+}    // namespace
+
+TEST(RouteTest, length_is_sum_of_legs)
+{
+    using namespace dubins;
+
+    Dubins::Options opt;
+    opt.turning_radius = 1.0;
+
+    const auto  waypoints = make_waypoints(20);
+    DubinsRoute route{waypoints, opt};
+
+    ASSERT_EQ(route.size(), waypoints.size() - 1);
+
+    double total = 0.0;
+    for (std::size_t i = 0; i + 1 < waypoints.size(); ++i)
+    {
+        Dubins leg{waypoints[i], waypoints[i + 1], opt};
+        EXPECT_NEAR(route.leg_offset(i), total, 1e-9);
+        total += leg.length();
+    }
+    EXPECT_NEAR(route.length(), total, 1e-9);
+}
+
+TEST(RouteTest, leg_index)
+{
+    using namespace dubins;
+
+    Dubins::Options opt;
+    const auto      waypoints = make_waypoints(30);
+    DubinsRoute     route{waypoints, opt};
+
+    EXPECT_EQ(route.leg_index(-1.0), 0U);
+    EXPECT_EQ(route.leg_index(0.0), 0U);
+    EXPECT_EQ(route.leg_index(route.length() + 1.0), route.size() - 1);
+
+    for (std::size_t i = 0; i < route.size(); ++i)
+    {
+        const auto mid = 0.5 * (route.leg_offset(i) + route.leg_offset(i + 1));
+        EXPECT_EQ(route.leg_index(mid), i);
+
+        // Waypoints are reached at the leg boundaries
+        const auto state = route.state_at(route.leg_offset(i));
+        EXPECT_NEAR(state.position.x, waypoints[i].position.x, 1e-9);
+        EXPECT_NEAR(state.position.y, waypoints[i].position.y, 1e-9);
+    }
+}
+
+TEST(RouteTest, segmented_path_is_continuous)
+{
+    using namespace dubins;
+
+    Dubins::Options opt;
+    opt.turning_radius         = 1.5;
+    opt.max_segment_length     = 0.1;
+    opt.min_number_of_segments = 30;
+
+    const auto  waypoints = make_waypoints(12);
+    DubinsRoute route{waypoints, opt};
+
+    const auto segments = route.segmented_path(opt);
+    const auto spacing  = route.length() / std::ceil(route.length() / opt.max_segment_length);
+
+    ASSERT_EQ(segments.size(), static_cast<std::size_t>(std::ceil(route.length() / opt.max_segment_length)) + 1);
+
+    // Chords can only be shorter than the arc length between points
+    for (std::size_t i = 0; i + 1 < segments.size(); ++i)
+    {
+        const auto chord = norm(segments[i + 1].position - segments[i].position);
+        EXPECT_LE(chord, spacing + 1e-9);
+        EXPECT_GT(chord, spacing * 0.99);
+    }
+
+    EXPECT_NEAR(segments.front().position.x, waypoints.front().position.x, 1e-12);
+    EXPECT_NEAR(segments.front().position.y, waypoints.front().position.y, 1e-12);
+    EXPECT_NEAR(segments.back().position.x, waypoints.back().position.x, 1e-9);
+    EXPECT_NEAR(segments.back().position.y, waypoints.back().position.y, 1e-9);
+}
+
+TEST(RouteTest, segmented_path_of_coincident_waypoints)
+{
+    using namespace dubins;
+
+    Dubins::Options opt;
+    opt.min_number_of_segments = 10;
+
+    const std::vector<State> waypoints(3, State{{0.0, 0.0}, 0.0});
+    DubinsRoute              route{waypoints, opt};
+    ASSERT_EQ(route.length(), 0.0);
+
+    const auto segments = route.segmented_path(opt);
+    ASSERT_EQ(segments.size(), static_cast<std::size_t>(opt.min_number_of_segments) + 1);
+    for (const auto& state : segments)
+    {
+        EXPECT_EQ(state.position.x, 0.0);
+        EXPECT_EQ(state.position.y, 0.0);
+        EXPECT_EQ(state.heading, 0.0);
+    }
+
+    opt.min_number_of_segments = 0;
+    EXPECT_EQ(route.segmented_path(opt).size(), 1u);
+}
+
+TEST(RouteTest, rebuild)
+{
+    using namespace dubins;
+
+    Dubins::Options opt;
+    DubinsRoute     route;
+
+    EXPECT_EQ(route.size(), 0U);
+    EXPECT_DOUBLE_EQ(route.length(), 0.0);
+    EXPECT_TRUE(route.segmented_path(opt).empty());
+
+    route.rebuild(make_waypoints(5), opt);
+    EXPECT_EQ(route.size(), 4U);
+
+    route.rebuild(make_waypoints(3), opt);
+    EXPECT_EQ(route.size(), 2U);
+    EXPECT_NEAR(route.length(), DubinsRoute(make_waypoints(3), opt).length(), 1e-12);
+}
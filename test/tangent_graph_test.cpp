@@ -0,0 +1,175 @@
+#include "dubins/Angle.hpp"
+#include "dubins/TangentGraph.hpp"
+#include "dubins/Trig.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <variant>
+#include <vector>
+
+
+namespace
+{
+// Position and heading at either end of a primitive
+dubins::State begin_of(const dubins::Primitive& primitive)
+{
+    using namespace dubins;
+    if (const auto* arc = std::get_if<ArcPrimitive>(&primitive))
+    {
+        const auto turn = arc->sweep >= 0.0 ? M_PI_2 : -M_PI_2;
+        return {arc->center + arc->radius * unit_vector(arc->start_angle), arc->start_angle + turn};
+    }
+    const auto& line = std::get<Line2D>(primitive);
+    return {line.a, angle_of(line.b - line.a)};
+}
+
+dubins::State end_of(const dubins::Primitive& primitive)
+{
+    using namespace dubins;
+    if (const auto* arc = std::get_if<ArcPrimitive>(&primitive))
+    {
+        const auto turn = arc->sweep >= 0.0 ? M_PI_2 : -M_PI_2;
+        return {arc->center + arc->radius * unit_vector(arc->end_angle), arc->end_angle + turn};
+    }
+    const auto& line = std::get<Line2D>(primitive);
+    return {line.b, angle_of(line.b - line.a)};
+}
+
+void expect_same(const dubins::State& a, const dubins::State& b, double tolerance)
+{
+    using namespace dubins;
+    EXPECT_NEAR(a.position.x, b.position.x, tolerance);
+    EXPECT_NEAR(a.position.y, b.position.y, tolerance);
+    EXPECT_NEAR(Angle::signed_difference(Angle{a.heading}, Angle{b.heading}), 0.0, tolerance);
+}
+
+// The path runs from start to goal without a break and never enters an obstacle
+void expect_valid(const dubins::TangentPath& path, const dubins::State& start, const dubins::State& goal,
+                  const std::vector<dubins::Circle>& obstacles)
+{
+    using namespace dubins;
+
+    ASSERT_FALSE(path.primitives.empty());
+    auto   current = start;
+    double total   = 0.0;
+    for (const auto& primitive : path.primitives)
+    {
+        // Heading is undefined on empty primitives
+        if (length(primitive) > 1e-9)
+        {
+            expect_same(begin_of(primitive), current, 1e-6);
+            current = end_of(primitive);
+        }
+        total += length(primitive);
+
+        for (double t = 0.0; t <= 1.0; t += 1.0 / 64.0)
+        {
+            Vector2D point;
+            if (const auto* arc = std::get_if<ArcPrimitive>(&primitive))
+            {
+                point = arc->center + arc->radius * unit_vector(arc->start_angle + t * arc->sweep);
+            }
+            else
+            {
+                const auto& line = std::get<Line2D>(primitive);
+                point            = line.a + t * (line.b - line.a);
+            }
+            for (const auto& obstacle : obstacles)
+            {
+                EXPECT_GE(norm(point - obstacle.center), obstacle.radius - 1e-6);
+            }
+        }
+    }
+
+    expect_same(current, goal, 1e-6);
+    EXPECT_NEAR(path.length, total, 1e-9);
+}
+
+}    // namespace
+
+TEST(TangentGraphTest, open_space)
+{
+    using namespace dubins;
+
+    TangentGraph graph{{}, {}};
+
+    const State start{{0.0, 0.0}, 0.0};
+    const State goal{{10.0, 6.0}, M_PI_2};
+
+    const auto path = graph.plan(start, goal);
+    ASSERT_TRUE(path.has_value());
+    expect_valid(*path, start, goal, {});
+
+    // Far apart the shortest path is one of the CSC words
+    EXPECT_NEAR(path->length, length(shortest_path(start, goal, 1.0)), 1e-9);
+}
+
+TEST(TangentGraphTest, around_obstacle)
+{
+    using namespace dubins;
+
+    const std::vector<Circle> obstacles{{{10.0, 0.0}, 2.0}, {{20.0, 8.0}, 1.5}, {{5.0, -6.0}, 1.0}};
+
+    TangentGraph::Options options;
+    options.turning_radius = 1.0;
+    options.clearance      = 0.5;
+    options.threads        = 2;
+
+    TangentGraph graph{obstacles, options};
+    EXPECT_GT(graph.edge_count(), 0u);
+
+    const State start{{0.0, 0.0}, 0.0};
+    const State goal{{20.0, 0.0}, 0.0};
+
+    // The straight line is blocked, the path hugs the inflated obstacle
+    const auto path = graph.plan(start, goal);
+    ASSERT_TRUE(path.has_value());
+    expect_valid(*path, start, goal, obstacles);
+    EXPECT_GT(path->length, 20.0);
+
+    const auto around = 2.0 * std::sqrt(10.0 * 10.0 - 2.5 * 2.5) + 2.5 * (M_PI - 2.0 * std::acos(2.5 / 10.0));
+    EXPECT_NEAR(path->length, around, 0.5);
+}
+
+TEST(TangentGraphTest, move)
+{
+    using namespace dubins;
+
+    std::vector<Circle> obstacles;
+    for (std::int32_t i = 0; i < 6; ++i)
+    {
+        for (std::int32_t j = 0; j < 4; ++j)
+        {
+            obstacles.push_back({{6.0 * i + 3.0 * (j % 2), 6.0 * j}, 1.0 + 0.25 * ((i + j) % 3)});
+        }
+    }
+
+    TangentGraph::Options options;
+    options.turning_radius = 1.0;
+    options.clearance      = 0.25;
+    options.threads        = 3;
+
+    TangentGraph graph{obstacles, options};
+
+    const State start{{-4.0, 3.0}, 0.0};
+    const State goal{{36.0, 15.0}, M_PI_2};
+
+    // Moving obstacles around, the updated graph agrees with a fresh one
+    const std::vector<std::pair<std::size_t, Circle>> moves{
+        {5, {{10.0, 4.0}, 1.0}}, {12, {{20.0, 14.0}, 1.5}}, {5, {{0.0, 30.0}, 0.5}}, {23, {{15.0, 9.0}, 1.2}}};
+    for (const auto& [index, circle] : moves)
+    {
+        graph.move(index, circle);
+        obstacles[index] = circle;
+
+        const TangentGraph fresh{obstacles, options};
+        EXPECT_EQ(graph.edge_count(), fresh.edge_count());
+
+        const auto updated  = graph.plan(start, goal);
+        const auto expected = fresh.plan(start, goal);
+        ASSERT_TRUE(updated.has_value());
+        ASSERT_TRUE(expected.has_value());
+        EXPECT_NEAR(updated->length, expected->length, 1e-9);
+        expect_valid(*updated, start, goal, obstacles);
+    }
+}
@@ -0,0 +1,96 @@
+#include "dubins/Dubins.hpp"
+#include "dubins/Trig.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+
+
+TEST(TrigTest, approx_atan2_error_bound)
+{
+    using namespace dubins;
+
+    double max_error = 0.0;
+    for (int i = 0; i < 200000; ++i)
+    {
+        const double angle  = -M_PI + 2.0 * M_PI * (i + 0.5) / 200000.0;
+        const double radius = 1.0e-3 + (i % 97) * 13.7;
+        const double y      = radius * std::sin(angle);
+        const double x      = radius * std::cos(angle);
+
+        max_error = std::max(max_error, std::abs(approx_atan2(y, x) - std::atan2(y, x)));
+    }
+
+    EXPECT_LT(max_error, approx_atan2_max_error);
+}
+
+TEST(TrigTest, approx_atan2_special_values)
+{
+    using namespace dubins;
+
+    EXPECT_EQ(approx_atan2(0.0, 0.0), std::atan2(0.0, 0.0));
+    EXPECT_EQ(approx_atan2(-0.0, 0.0), std::atan2(-0.0, 0.0));
+    EXPECT_TRUE(std::signbit(approx_atan2(-0.0, 0.0)));
+    EXPECT_DOUBLE_EQ(approx_atan2(0.0, -0.0), std::atan2(0.0, -0.0));
+    EXPECT_DOUBLE_EQ(approx_atan2(-0.0, -1.0), std::atan2(-0.0, -1.0));
+    EXPECT_DOUBLE_EQ(approx_atan2(1.0, 0.0), M_PI_2);
+    EXPECT_DOUBLE_EQ(approx_atan2(-1.0, 0.0), -M_PI_2);
+    EXPECT_DOUBLE_EQ(approx_atan2(0.0, 1.0), 0.0);
+    EXPECT_DOUBLE_EQ(approx_atan2(0.0, -1.0), M_PI);
+    EXPECT_DOUBLE_EQ(approx_atan2(1.0, 1.0), M_PI_4);
+    EXPECT_DOUBLE_EQ(approx_atan2(-1.0, -1.0), -3.0 * M_PI_4);
+    EXPECT_TRUE(std::isnan(approx_atan2(std::nan(""), 1.0)));
+}
+
+TEST(TrigTest, approx_sincos_error_bound)
+{
+    using namespace dubins;
+
+    double max_error = 0.0;
+    for (double angle = -1.0e6; angle < 1.0e6; angle += 0.9973)
+    {
+        double s;
+        double c;
+        approx_sincos(angle, s, c);
+
+        max_error = std::max(max_error, std::abs(s - std::sin(angle)));
+        max_error = std::max(max_error, std::abs(c - std::cos(angle)));
+    }
+
+    EXPECT_LT(max_error, approx_sincos_max_error);
+
+    double s;
+    double c;
+    approx_sincos(std::nan(""), s, c);
+    EXPECT_TRUE(std::isnan(s));
+    EXPECT_TRUE(std::isnan(c));
+
+    approx_sincos(INFINITY, s, c);
+    EXPECT_TRUE(std::isnan(s));
+    EXPECT_TRUE(std::isnan(c));
+}
+
+TEST(TrigTest, approximate_mode_path_length)
+{
+    using namespace dubins;
+
+    Dubins::Options opt;
+    opt.turning_radius = 2.0;
+
+    const auto mode = trig_mode();
+
+    for (double heading = -3.0; heading < 3.0; heading += 0.37)
+    {
+        State start{{0.0, 0.0}, heading};
+        State end{{7.0, -3.0}, -heading * 0.5};
+
+        set_trig_mode(TrigMode::exact);
+        Dubins exact{start, end, opt};
+
+        set_trig_mode(TrigMode::approximate);
+        Dubins approx{start, end, opt};
+
+        EXPECT_NEAR(approx.length(), exact.length(), 1e-8);
+    }
+
+    set_trig_mode(mode);
+}